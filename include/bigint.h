@@ -1,1839 +1,3963 @@
-/**
- * @file bigint.h
- * @author Celeste Luis Díaz (alu0101321660@ull.edu.es)
- * @brief Clase BigInt<Base> diseñada para la segunda práctica de 
- * Algoritmos y Estructuras de Datos Avanazadas 2022-2023
- * 
- *         ** Impementación de la especialización para la base 2
- *         ** Cambios de tipo incluidos.
- *         ** Se realizan las operaciones mediante una calculadora RPN
- * 
- * @version 0.1
- * @date 2023-03-01
- * 
- * @copyright Copyright (c) 2023
- * 
- */
- 
-#include <iostream>
-#include <vector>
-#include <regex>
-#include <math.h>
-
-template <size_t Base>
-class BigInt;
-
-// Flow Operators
-template <size_t Base> std::ostream &operator<<(std::ostream &, const BigInt<Base> &);
-template <size_t Base> std::istream &operator>>(std::istream &, BigInt<Base> &);
-
-// Comparison Operators
-template <size_t Base> bool operator==(const BigInt<Base>&, const BigInt<Base>&);
-template <size_t Base> bool operator>(const BigInt<Base>&, const BigInt<Base>&);
-template <size_t Base> bool operator<(const BigInt<Base>&, const BigInt<Base>&);
-
-// Arithmetic Operators
-template <size_t Base> BigInt<Base> operator+(const BigInt<Base>&, const BigInt<Base>&);
-template <size_t Base> BigInt<Base> operator/(const BigInt<Base>&, const BigInt<Base>&);
-
-// Pow
-template <size_t Base> BigInt<Base> pow(const BigInt<Base>&, const BigInt<Base>&);
-
-// Espcialización de la clase BigInt para la base 2
-
-template <> std::ostream &operator<<(std::ostream &, const BigInt<2> &);
-template <> std::istream &operator>>(std::istream &, BigInt<2> &);
-template <> bool operator==(const BigInt<2>&, const BigInt<2>&);
-template <> bool operator>(const BigInt<2>&, const BigInt<2>&);
-template <> bool operator<(const BigInt<2>&, const BigInt<2>&);
-template <> BigInt<2> operator+(const BigInt<2>&, const BigInt<2>&);
-template <> BigInt<2> operator/(const BigInt<2>&, const BigInt<2>&);
-template <> BigInt<2> pow(const BigInt<2>&, const BigInt<2>&);
-
-template <>
-class BigInt<2> {
-
-    private:
-        std::vector<bool> digits_;
-        int sign_ = 0;
-
-    public:
-        BigInt(long value = 0);
-        BigInt(std::string& value);
-        BigInt(const char* value);
-        BigInt(const BigInt<2>& value);
-        BigInt(std::vector<bool> digits);
-        ~BigInt() = default;
-
-        // Asignment Operators
-        BigInt<2>& operator=(const BigInt<2>& num);
-
-        // Flow Operators
-        friend std::ostream &operator<<(std::ostream &, const BigInt<2> &);
-        friend std::istream &operator>>(std::istream &, BigInt<2> &);
-
-        // Accesor Methods
-        int sign() const; 
-        char operator[](int) const; 
-        std::vector<bool> digits() const;
-        void setSign(int sign);
-        void setDigits(std::vector<bool> digits);
-        void setPosition(int position, bool value);
-
-        // Comparison Operators
-        friend bool operator==(const BigInt<2>& num1, const BigInt<2>& num2);
-        bool operator!=(const BigInt<2>& num) const;
-        friend bool operator>(const BigInt<2>& num1, const BigInt<2>& num2);
-        bool operator>=(const BigInt<2>& num) const;
-        friend bool operator< (const BigInt<2>& num1, const BigInt<2>& num2);
-        bool operator<=(const BigInt<2>& num) const;
-
-        // Increment and Decrement Operators
-        BigInt<2>& operator++(); 
-        BigInt<2> operator++(int value); 
-        BigInt<2>& operator--(); 
-        BigInt<2> operator--(int value); 
-
-        // Arithmetic Operators
-        friend BigInt<2> operator+(const BigInt<2>&, const BigInt<2>&);
-        BigInt<2> operator-(const BigInt<2> &) const;
-        BigInt<2> operator-() const;
-        BigInt<2> operator*(const BigInt<2>&) const;
-        friend BigInt<2> operator/(const BigInt<2>&, const BigInt<2>&);
-        BigInt<2> operator%(const BigInt<2>&) const;
-
-        // Pow
-        friend BigInt<2> pow(const BigInt<2>&, const BigInt<2>&);
-
-        BigInt<2> complementTwo() const;
-        BigInt<2> abs() const;
-
-        template<size_t Base> operator BigInt<Base>() const;
-
-        //ToString
-        std::string toString() const;
-
-        // Binary to Octal
-        std::string binaryToOctal(std::string binaryStr);
-};
-
-BigInt<2>::BigInt(long value) {}
-
-BigInt<2>::BigInt(std::string& value) {
-
-    if (value[0] == '0') {
-        sign_ = 0;
-        value = value.substr(1);
-    } else {
-        sign_ = 1;
-        value = value.substr(1);
-    }
-
-    for (int i = value.size() - 1; i >= 0; i--) {
-        if (value[i] == '0') {
-            digits_.push_back(false);
-        } else {
-            digits_.push_back(true);
-        }
-    }
-
-}
-
-BigInt<2>::BigInt(const char* value) {
-
-    if (value[0] == '0') {
-        sign_ = 0;
-        // Eliminar esa posicion
-        value = value + 1;
-    } else {
-        sign_ = 1;
-        // Eliminar esa posicion
-        value = value + 1;
-    }
-
-    for (int i = strlen(value) - 1; i >= 0; i--) {
-        if (value[i] == '0') {
-            digits_.push_back(false);
-        } else {
-            digits_.push_back(true);
-        }
-    }
-}
-
-BigInt<2>::BigInt(const BigInt<2>& value) {
-    digits_ = value.digits_;
-    sign_ = value.sign_;
-}
-
-// Asignment Operators
-BigInt<2>& BigInt<2>::operator=(const BigInt<2>& num) {
-    digits_ = num.digits_;
-    sign_ = num.sign_;
-
-    return *this;
-}
-
-// Accesor Methods
-int BigInt<2>::sign() const {
-    return sign_;
-}
-
-char BigInt<2>::operator[](int index) const {
-    return digits_[index];
-}
-
-std::vector<bool> BigInt<2>::digits() const {
-    return digits_;
-}
-
-void BigInt<2>::setSign(int sign) {
-    sign_ = sign;
-}
-
-void BigInt<2>::setDigits(std::vector<bool> digits) {
-    digits_ = digits;
-}
-
-void BigInt<2>::setPosition(int position, bool value) {
-    digits_[position] = value;
-}
-
-// Comparison Operators
-bool operator==(const BigInt<2>& num1, const BigInt<2>& num2) {
-
-    if (num1.sign_ != num2.sign_) {
-        return false;
-    }
-
-    if (num1.digits_.size() != num2.digits_.size()) {
-        for (int i = 0; i < num1.digits_.size(); i++) {
-            for (int j = 0; j < num2.digits_.size(); j++) {
-                if (num1.digits_[i] == false && num2.digits_[j] == false) {
-                    return true;
-                }
-            }
-        }
-        return false;
-    }
-
-    for (int i = 0; i < num1.digits_.size(); i++) {
-        if (num1.digits_[i] != num2.digits_[i]) {
-            return false;
-        }
-    }
-
-    return true;
-}
-
-bool BigInt<2>::operator!=(const BigInt<2>& num) const {
-    return !(*this == num);
-}
-
-bool operator>(const BigInt<2>& num1, const BigInt<2>& num2) {
-
-    // Comprobar que los dos números tengan el mismo número de dígitos
-    int size1 = num1.digits_.size();
-    int size2 = num2.digits_.size();
-
-    BigInt<2> aux1 = num1;
-    BigInt<2> aux2 = num2;
-
-    if (size1 > size2) {
-        for (int i = 0; i < size1 - size2; i++) {
-            aux2.digits_.push_back(false);
-        }
-    } else if (size1 < size2) {
-        for (int i = 0; i < size2 - size1; i++) {
-            aux1.digits_.push_back(false);
-        }
-    }
-
-    // Comprobar el signo
-    if (num1.sign_ == 1 && num2.sign_ == 0) {
-        return true;
-    } else if (num1.sign_ == 0 && num2.sign_ == 1) {
-        return false;
-    }
-
-    // Comprobar los dígitos
-    for (int i = aux1.digits_.size() - 1; i >= 0; i--) {
-        if (aux1.digits_[i] == true && aux2.digits_[i] == false) {
-            return true;
-        } else if (aux1.digits_[i] == false && aux2.digits_[i] == true) {
-            return false;
-        }
-    }
-
-    return false;
-}
-
-bool operator<(const BigInt<2>& num1, const BigInt<2>& num2) {
-    return !(num1 > num2 || num1 == num2);
-}
-
-bool operator>=(const BigInt<2>& num1, const BigInt<2>& num2) {
-    return (num1 > num2 || num1 == num2);
-}
-
-bool operator<=(const BigInt<2>& num1, const BigInt<2>& num2) {
-    return (num1 < num2 || num1 == num2);
-}
-
-// Increment and Decrement Operators
-BigInt<2>& BigInt<2>::operator++() {
-    *this = *this + BigInt<2>("01");
-    return *this;
-}
-
-BigInt<2> BigInt<2>::operator++(int) {
-    BigInt<2> aux = *this;
-    ++(*this);
-    return aux;
-}
-
-BigInt<2>& BigInt<2>::operator--() {
-    *this = *this - BigInt<2>("01");
-    return *this;
-}
-
-BigInt<2> BigInt<2>::operator--(int) {
-    BigInt<2> aux = *this;
-    --(*this);
-    return aux;
-}
-
-// Arithmetic Operators
-
-BigInt<2> operator+(const BigInt<2>& num1, const BigInt<2>& num2) {
-
-
-    int size1 = num1.digits_.size();
-    int size2 = num2.digits_.size();
-
-    BigInt<2> aux1 = num1;
-    BigInt<2> aux2 = num2;
-
-    
-    BigInt<2> result;
-    result.digits_.resize(std::max(size1, size2), false);
-
-    bool carry = false;
-
-    if (aux1.sign_ == 0 && aux2.sign_ == 0) {
-
-        if (size1 > size2) {
-            for (int i = 0; i < size1 - size2; i++) {
-                aux2.digits_.push_back(false);
-            }
-        } else if (size1 < size2) {
-            for (int i = 0; i < size2 - size1; i++) {
-                aux1.digits_.push_back(false);
-            }
-        }
-
-        for(int i = 0; i < result.digits_.size(); i++) {
-            if (aux1.digits_[i] == false && aux2.digits_[i] == false) {
-                if (carry == true) {
-                    result.digits_[i] = true;
-                    carry = false;
-                } else {
-                    result.digits_[i] = false;
-                }
-            } else if (aux1.digits_[i] == true && aux2.digits_[i] == true) {
-                if (carry == true) {
-                    result.digits_[i] = true;
-                } else {
-                    result.digits_[i] = false;
-                    carry = true;
-                }
-            } else {
-                if (carry == true) {
-                    result.digits_[i] = false;
-                } else {
-                    result.digits_[i] = true;
-                }
-            }
-        }
-        if (carry == true) {
-            result.digits_.push_back(true);
-        }
-    } else if (aux1.sign_ == 1 && aux2.sign_ == 1) {
-
-        if (size1 > size2) {
-            for (int i = 0; i < size1 - size2; i++) {
-                aux2.digits_.push_back(true);
-            }
-        } else if (size1 < size2) {
-            for (int i = 0; i < size2 - size1; i++) {
-                aux1.digits_.push_back(true);
-            }
-        }
-
-        result = aux1.abs() + aux2.abs();
-
-        result = result.complementTwo();
-        result.digits_[result.digits_.size()] = true;
-        result.sign_ = 1;
-
-    } else if (aux1.sign_ == 0 && aux2.sign_ == 1) {
-
-        if (size1 > size2) {
-            for (int i = 0; i < size1 - size2; i++) {
-                aux2.digits_.push_back(true);
-            }
-        } else if (size1 < size2) {
-            for (int i = 0; i < size2 - size1; i++) {
-                aux1.digits_.push_back(false);
-            }
-        }
-
-        if (aux1 > aux2.abs()) {
-
-            result = aux1 - aux2.abs();
-
-        } else {
-            result = aux2.abs() - aux1;
-            result = result.complementTwo();
-            result.digits_[result.digits_.size()] = true;
-            result.sign_ = 1;
-
-        }
-    } else if (aux1.sign_ == 1 && aux2.sign_ == 0) {
-
-        if (size1 > size2) {
-            for (int i = 0; i < size1 - size2; i++) {
-                aux2.digits_.push_back(false);
-            }
-        } else if (size1 < size2) {
-            for (int i = 0; i < size2 - size1; i++) {
-                aux1.digits_.push_back(true);
-            }
-        }
-
-        if (aux1.abs() > aux2) {
-
-            result = aux1.abs() - aux2;
-            result = result.complementTwo();
-            result.digits_[result.digits_.size()] = true;
-            result.sign_ = 1;
-
-        } else if (aux1.abs() < aux2) {
-            result = aux2 - aux1.abs();
-        }
-    }
-
-    return result;
-}
-
-BigInt<2> BigInt<2>::operator-(const BigInt<2> &num) const {
-
-    int size1 = digits_.size();
-    int size2 = num.digits_.size();
-
-    BigInt<2> aux1 = *this;
-    BigInt<2> aux2 = num;
-
-    
-    BigInt<2> result;
-
-    result.digits_.resize(std::max(size1, size2), false);
-
-    if (aux1.sign_ == 1 && aux2.sign_ == 1) {
-        if (size1 > size2) {
-            for (int i = 0; i < size1 - size2; i++) {
-                aux2.digits_.push_back(true);
-            }
-        } else if (size1 < size2) {
-            for (int i = 0; i < size2 - size1; i++) {
-                aux1.digits_.push_back(true);
-            }
-        }
-
-        result = aux1.abs() + aux2.abs();
-
-        result = result.complementTwo();
-        result.digits_[result.digits_.size()] = true;
-        result.sign_ = 1;
-
-    } else if (aux1.sign_ == 0 && aux2.sign_ == 0) {
-
-        if (size1 > size2) {
-            for (int i = 0; i < size1 - size2; i++) {
-                aux2.digits_.push_back(false);
-            }
-        } else if (size1 < size2) {
-            for (int i = 0; i < size2 - size1; i++) {
-                aux1.digits_.push_back(false);
-            }
-        }
-
-        if (aux1 > aux2) {
-
-            bool carry = false;
-            for(int i = 0; i < result.digits_.size(); i++) { 
-                if (aux1.digits_[i] == false && aux2.digits_[i] == false) { // 0 - 0 -> Carry = 0
-                    if (carry == true) {
-                        result.digits_[i] = true;
-                        carry = true;
-                    } else {
-                        result.digits_[i] = false;
-                    }
-                } else if (aux1.digits_[i] == true && aux2.digits_[i] == true) { // 1 - 1 -> Carry = 0
-                    if (carry == true) {
-                        result.digits_[i] = true;
-                        carry = true;
-                    } else {
-                        result.digits_[i] = false;
-                    }
-                } else if (aux1.digits_[i] == false && aux2.digits_[i] == true) { // 0 - 1 -> Carry = 1
-                    if (carry == true) {
-                        result.digits_[i] = false;
-                        carry = true;
-                    } else {
-                        result.digits_[i] = true;
-                        carry = true;
-                    }
-                } else { // 1 - 0 -> Carry = 0
-                    if (carry == true) {
-                        result.digits_[i] = false;
-                        carry = false;
-                    } else {
-                        result.digits_[i] = true;
-                    }
-                }
-            }
-
-            if (carry == true) {
-                result.digits_.push_back(true);
-            }
-
-        } else {
-
-
-            aux2 = aux2.complementTwo();
-            aux2.digits_[aux2.digits_.size()] = true;
-            aux2.setSign(1);
-
-            result = aux1 + aux2;
-        }
-
-    } else if (aux1.sign_ == 0 && aux2.sign_ == 1) {
-        if (size1 > size2) {
-            for (int i = 0; i < size1 - size2; i++) {
-                aux2.digits_.push_back(true);
-            }
-        } else if (size1 < size2) {
-            for (int i = 0; i < size2 - size1; i++) {
-                aux1.digits_.push_back(false);
-            }
-        }
-
-        result = aux1 + aux2.abs();
-
-    } else if (aux1.sign_ == 1 && aux2.sign_ == 0) {
-
-        if (size1 > size2) {
-            for (int i = 0; i < size1 - size2; i++) {
-                aux2.digits_.push_back(false);
-            }
-        } else if (size1 < size2) {
-            for (int i = 0; i < size2 - size1; i++) {
-                aux1.digits_.push_back(true);
-            }
-        }
-
-        result = aux1.abs() + aux2;
-        result = result.complementTwo();
-        result.digits_[result.digits_.size()] = true;
-        result.sign_ = 1;
-    }
-
-    return result;
-}
-
-BigInt<2> BigInt<2>::complementTwo() const {
-
-    if (this->sign_ == 1) {
-        return *this;
-    }
-
-    BigInt<2> result;
-
-    result.digits_.resize(this->digits_.size(), false);
-
-    BigInt<2> aux = *this;
-    aux.setPosition(aux.digits_.size(), true);
-
-    int i = 0; 
-    for (i = 0; i < this->digits_.size() + 1; i++) {
-        if (aux.digits_[i]) {
-            result.digits_[i] = true;
-            break;
-        } else {
-            result.digits_[i] = false;
-        }
-    }
-
-    // Invertir los dígitos
-    for (i = i + 1; i < this->digits_.size() + 1; i++) {
-        if (aux.digits_[i]) {
-            result.digits_[i] = false;
-        } else {
-            result.digits_[i] = true;
-        }
-    }
-
-    return result;
-}
-
-BigInt<2> BigInt<2>::abs() const {
-
-    if (this->sign_ == 0) {
-        return *this;
-    }
-
-    BigInt<2> result;
-
-    result.digits_.resize(this->digits_.size(), false);
-
-    int i = 0;
-    for (i = 0; i < this->digits_.size(); i++) {
-        if (this->digits_[i]) {
-            result.digits_[i] = true;
-            break;
-        } else {
-            result.digits_[i] = false;
-        }
-    }
-
-    // Invertir los demas
-
-    for (i = i + 1; i < this->digits_.size(); i++) {
-        if (this->digits_[i]) {
-            result.digits_[i] = false;
-        } else {
-            result.digits_[i] = true;
-        }
-    }
-
-    return result;
-
-}
-
-
-
-BigInt<2> BigInt<2>::operator-() const {
-    if(this->sign_ == 0) {
-        BigInt<2> result = *this;
-        result = result.complementTwo();
-        result.digits_[result.digits_.size()] = true;
-        result.sign_ = 1;
-        return result;
-    } else {
-        BigInt<2> result = *this;
-        result = result.abs();
-        result.sign_ = 0;
-        return result;
-    }
-}
-
-BigInt<2> BigInt<2>::operator*(const BigInt<2>& num) const {
-    BigInt<2> result;
-    BigInt<2> aux1 = *this;
-    BigInt<2> aux2 = num;
-
-    if (aux1.sign_ == 1) {
-        aux1 = aux1.abs(); // Convertir a positivo
-    }
-
-    if (aux2.sign_ == 1) {
-        aux2 = aux2.abs(); // Convertir a positivo
-    }
-
-    int size1 = aux1.digits_.size();
-    int size2 = aux2.digits_.size();
-
-    if (size1 > size2) {
-        for (int i = 0; i < size1 - size2; i++) {
-            aux2.digits_.push_back(false);
-        }
-    } else if (size1 < size2) {
-        for (int i = 0; i < size2 - size1; i++) {
-            aux1.digits_.push_back(false);
-        }
-    }
-
-    result.digits_.resize(size1 + size2, false);
-
-    // 0 x 0 = 0
-    // 0 x 1 = 0
-    // 1 x 0 = 0
-    // 1 x 1 = 1 
-
-    for (int i = 0; i < aux1.digits_.size(); i++) {
-        bool carry = false;
-        for (int j = 0; j < aux2.digits_.size(); j++) {
-            bool product = aux1.digits_[i] && aux2.digits_[j];
-            bool sum = result.digits_[i+j] ^ product ^ carry;
-            carry = (result.digits_[i+j] && product) || (result.digits_[i+j] && carry) || (product && carry);
-            result.digits_[i+j] = sum;
-        }
-        if (carry) {
-            result.digits_[i+aux2.digits_.size()] = true;
-        }
-    }
-
-
-    if (this->sign_ == 1 && num.sign_ == 0) {
-        result = result.complementTwo();
-        result.digits_[result.digits_.size()] = true;
-        result.sign_ = 1;
-        
-    } else if (this->sign_ == 0 && num.sign_ == 1) {
-        result = result.complementTwo();
-        result.digits_[result.digits_.size()] = true;
-        result.sign_ = 1;
-    }
-
-
-    return result;
-}
-
-
-BigInt<2> operator/(const BigInt<2>& dividend, const BigInt<2>& divisor) {
-
-    BigInt<2> result;
-
-    BigInt<2> aux1 = dividend;
-
-    if(dividend.sign_ == 1) {
-        aux1 = aux1.abs();
-    }
-
-    BigInt<2> aux2 = divisor;
-
-    if(divisor.sign_ == 1) {
-        aux2 = aux2.abs();
-    }
-
-    int size1 = aux1.digits_.size();
-    int size2 = aux2.digits_.size();
-
-    if (size1 > size2) {
-        for (int i = 0; i < size1 - size2; i++) {
-            aux2.digits_.push_back(false);
-        }
-    } else if (size1 < size2) {
-        for (int i = 0; i < size2 - size1; i++) {
-            aux1.digits_.push_back(false);
-        }
-    }
-
-    result.digits_.resize(size1 + size2, false);
-
-    // 0 / 0 = 0
-    // 0 / 1 = 0
-    // 1 / 0 = 0
-    // 1 / 1 = 1
-
-    while (aux1 > aux2) {
-        aux1 = aux1 - aux2;
-        result = result + BigInt<2>("01");
-    }
-
-    if (aux1 == aux2) {
-        result = result + BigInt<2>("01");
-    }
-
-    // Si los signos son diferentes el resultado es negativo
-
-    if (dividend.sign_ == 1 && divisor.sign_ == 0) {
-        result = result.complementTwo();
-        result.digits_[result.digits_.size()] = true;
-        result.sign_ = 1;
-    } else if (dividend.sign_ == 0 && divisor.sign_ == 1) {
-        result = result.complementTwo();
-        result.digits_[result.digits_.size()] = true;
-        result.sign_ = 1;
-    }
-
-    return result;
-
-}
-
-BigInt<2> BigInt<2>::operator%(const BigInt<2>& num) const {
-    BigInt<2> result;
-    BigInt<2> aux;
-    // Dividir hasta que el resto sea menor que el divisor
-    if (num.sign() == 1) {
-        aux = num.abs();
-    } else {
-        aux = num;
-    }
-
-    if (this->sign() == 1) {
-        result = this->abs();
-    } else {
-        result = *this;
-    }
-
-    if (result < aux) {
-        return result;
-    }
-
-    while (result > aux) {
-        result = result - aux;
-    }
-
-    return result;
-}
-
-
-// Flow Operators
-std::ostream &operator<<(std::ostream &os, const BigInt<2> &num) {
-
-    // Imprimir el signo
-    if (num.sign_ == 1) {
-        os << "1";
-    } else {
-        os << "0";
-    }
-
-
-    for (int i = num.digits_.size(); i >= 0; i--) {
-        if (num.digits_[i]) {
-            os << "1";
-        } else {
-            os << "0";
-        }
-    }
-
-    return os;
-}
-
-// Cambio de tipo
-
-template <size_t Base>
-BigInt<2>::operator BigInt<Base>() const {
-
-    BigInt<Base> result;
-    BigInt<2> aux = *this;
-
-    switch (Base) {
-        case 2:
-            return *this;
-            break;
-
-        case 8:
-            {
-                if (aux.sign_ == 1) {
-                    aux = aux.abs();
-                } 
-
-
-                // Comprobar que aux tiene un numero de digitos multiplo de 3
-                if (aux.digits_.size() % 3 != 0) {
-                    for (int i = 0; i < 3 - (aux.digits_.size() % 3); i++) {
-                        aux.digits_.push_back(false);
-                    }
-                }
-
-                std::string digitsOctal;
-
-                // Recorrer los digitos de aux de 3 en 3
-                for (int i = 0; i < aux.digits_.size(); i += 3) {
-                    int sum = 0;
-                    for (int j = 0; j < 3; j++) {
-                        sum += aux.digits_[i+j] * std::pow(2, j);
-                    }
-                    digitsOctal += std::to_string(sum);
-                }
-
-                // Invertir el string
-                std::reverse(digitsOctal.begin(), digitsOctal.end());
-
-                // Eliminar los ceros a la izquierda
-                while (digitsOctal[0] == '0') {
-                    digitsOctal.erase(0, 1);
-                }
-
-                result = BigInt<Base>(digitsOctal);
-
-                if (sign_ == 1) {
-                    result.setSign(-1);
-                }
-
-                return result;
-
-                break;
-                
-            }
-            
-        case 10:
-            {
-                if (aux.sign_ == 1) {
-                    aux = aux.abs();
-                } 
-
-                for (int i = 0; i < aux.digits_.size(); ++i) {
-                    if (aux.digits_[i]) {
-                        result = result + BigInt<Base>(std::pow(2, i));
-                    }
-                }
-
-                if (sign_ == 1) {
-                    result.setSign(-1);
-                }
-
-                return result;
-
-                break;
-            }
-
-        case 16:
-            {
-                if (aux.sign_ == 1) {
-                    aux = aux.abs();
-                } 
-
-                // Comprobar que aux tiene un numero de digitos multiplo de 4
-                if (aux.digits_.size() % 4 != 0) {
-                    for (int i = 0; i < 4 - (aux.digits_.size() % 4); i++) {
-                        aux.digits_.push_back(false);
-                    }
-                }
-
-                std::string digitsHex;
-
-                // Recorrer los digitos de aux de 4 en 4
-                for (int i = 0; i < aux.digits_.size(); i += 4) {
-                    int sum = 0;
-                    for (int j = 0; j < 4; j++) {
-                        sum += aux.digits_[i+j] * std::pow(2, j);
-                    }
-                    switch (sum) {
-                        case 10:
-                            digitsHex += "A";
-                            break;
-                        case 11:
-                            digitsHex += "B";
-                            break;
-                        case 12:
-                            digitsHex += "C";
-                            break;
-                        case 13:
-                            digitsHex += "D";
-                            break;
-                        case 14:
-                            digitsHex += "E";
-                            break;
-                        case 15:
-                            digitsHex += "F";
-                            break;
-                        default:
-                            digitsHex += std::to_string(sum);
-                            break;
-                    }
-                }
-
-                // Invertir el string
-                std::reverse(digitsHex.begin(), digitsHex.end());
-
-                // Eliminar los ceros a la izquierda
-                while (digitsHex[0] == '0') {
-                    digitsHex.erase(0, 1);
-                }
-
-                result = BigInt<Base>(digitsHex);
-
-                if (sign_ == 1) {
-                    result.setSign(-1);
-                }
-
-                return result;
-
-                break;
-            }
-        default:
-            return *this;
-            break;
-    }
-
-}
-
-
-
-
-template <size_t Base = 10>
-class BigInt {
-
-    private:
-        bool checkBase();
-        bool checkDigits(char digit);
-
-        std::vector<char> digits_;
-        int sign_;
-
-    public:
-        BigInt(long value = 0);
-        BigInt(std::string& value);
-        BigInt(const char* value);
-        BigInt(const BigInt<Base>& value);
-        ~BigInt();
-
-        // Asignment Operators
-        BigInt<Base>& operator=(const BigInt<Base>& num);
-
-        // Flow Operators
-        friend std::ostream &operator<<<Base>(std::ostream &, const BigInt<Base> &);
-        friend std::istream &operator>><Base>(std::istream &, BigInt<Base> &);
-
-        // Accesor Methods
-        int sign() const; 
-        char operator[](int) const; 
-
-        //Setters
-        void setSign(int sign);
-
-        // Comparison Operators
-        friend bool operator==<Base>(const BigInt<Base>& num1, const BigInt<Base>& num2);
-        bool operator!=(const BigInt<Base>& num) const;
-        friend bool operator><Base>(const BigInt<Base>& num1, const BigInt<Base>& num2);
-        bool operator>=(const BigInt<Base>& num) const;
-        friend bool operator< <Base>(const BigInt<Base>& num1, const BigInt<Base>& num2);
-        bool operator<=(const BigInt<Base>& num) const;
-
-        // Increment and Decrement Operators
-        BigInt<Base>& operator++(); 
-        BigInt<Base> operator++(int value); 
-        BigInt<Base>& operator--(); 
-        BigInt<Base> operator--(int value); 
-
-        // Arithmetic Operators
-        friend BigInt<Base> operator+<Base>(const BigInt<Base>&, const BigInt<Base>&);
-        BigInt<Base> operator-(const BigInt<Base> &) const;
-        BigInt<Base> operator-() const;
-        BigInt<Base> operator*(const BigInt<Base>&) const;
-        friend BigInt<Base> operator/<Base>(const BigInt<Base>&, const BigInt<Base>&);
-        BigInt<Base> operator%(const BigInt<Base>&) const;
-
-        // Pow
-        friend BigInt<Base> pow<Base>(const BigInt<Base>&, const BigInt<Base>&);
-
-        // Type Conversion
-
-        operator BigInt<2>() {
-
-            BigInt<2> result;
-
-            switch (Base) {
-                case 2:
-                    result = *this;
-                    break;
-                case 8:
-                    {
-                        std::string binaryDigits;
-
-                        if (sign_ == -1) {
-                            binaryDigits += "1";
-                        } else {
-                            binaryDigits += "0";
-                        }
-
-                        // Recorrer todos los digitos de this empezando por el final
-                        for (int i = digits_.size() - 1; i >= 0; --i) {
-                            // Convertir el digito octal a binario
-                            switch (digits_[i]) {
-                                case '0':
-                                    binaryDigits += "000";
-                                    break;
-                                case '1':
-                                    binaryDigits += "001";
-                                    break;
-                                case '2':
-                                    binaryDigits += "010";
-                                    break;
-                                case '3':
-                                    binaryDigits += "011";
-                                    break;
-                                case '4':
-                                    binaryDigits += "100";
-                                    break;
-                                case '5':
-                                    binaryDigits += "101";
-                                    break;
-                                case '6':
-                                    binaryDigits += "110";
-                                    break;
-                                case '7':
-                                    binaryDigits += "111";
-                                    break;
-                            }
-                        }
-
-                        result = BigInt<2>(binaryDigits);
-
-                        return result;
-
-                        break;
-                    }
-                case 10:
-                    {
-                        BigInt<Base> num(*this);
-
-                        if (sign_ == -1) {
-                            num = -num;
-                        }
-
-                        BigInt<Base> two(2L);
-                        BigInt<Base> zero(0L);
-
-                        std::vector<bool> digits;
-
-                        while(num > two) {
-                            if(num % two == zero) {
-                                digits.push_back(false);
-                            } else {
-                                digits.push_back(true);
-                            }
-                            num = num / two;
-                        }
-                        
-                        if (num < two) {
-                            digits.push_back(true);
-                        }
-
-                        if (num == two) {
-                            digits.push_back(false);
-                            digits.push_back(true);
-                        }
-
-                        digits.push_back(false); // Signo
-
-                        // Recorrer digits desde el final e introducirlo en un string
-                        std::string binaryDigits;
-
-                        for (int i = digits.size() - 1; i >= 0; --i) {
-                            if (digits[i]) {
-                                binaryDigits += "1";
-                            } else {
-                                binaryDigits += "0";
-                            }
-                        }
-
-                        if (sign_ == -1) {
-                            result = BigInt<2>(binaryDigits);
-                            result = result.complementTwo();
-                            result.setSign(1);
-
-                            return result;
-
-                        } else {
-                            result = BigInt<2>(binaryDigits);
-                            return result;
-                        }
-
-                        return result = BigInt<2>("00");
-
-                    }
-
-                case 16:
-                    {
-                        std::string binaryDigits;
-
-                        if (sign_ == -1) {
-                            binaryDigits += "1";
-                        } else {
-                            binaryDigits += "0";
-                        }
-
-                        // Recorrer todos los digitos de this empezando por el final
-                        for (int i = digits_.size() - 1; i >= 0; --i) {
-                            // Convertir el digito hexadecimal a binario
-                            switch (digits_[i]) {
-                                case '0':
-                                    binaryDigits += "0000";
-                                    break;
-                                case '1':
-                                    binaryDigits += "0001";
-                                    break;
-                                case '2':
-                                    binaryDigits += "0010";
-                                    break;
-                                case '3':
-                                    binaryDigits += "0011";
-                                    break;
-                                case '4':
-                                    binaryDigits += "0100";
-                                    break;
-                                case '5':
-                                    binaryDigits += "0101";
-                                    break;
-                                case '6':
-                                    binaryDigits += "0110";
-                                    break;
-                                case '7':
-                                    binaryDigits += "0111";
-                                    break;
-                                case '8':
-                                    binaryDigits += "1000";
-                                    break;
-                                case '9':
-                                    binaryDigits += "1001";
-                                    break;
-                                case 'A':
-                                    binaryDigits += "1010";
-                                    break;
-                                case 'B':
-                                    binaryDigits += "1011";
-                                    break;
-                                case 'C':
-                                    binaryDigits += "1100";
-                                    break;
-                                case 'D':
-                                    binaryDigits += "1101";
-                                    break;
-                                case 'E':
-                                    binaryDigits += "1110";
-                                    break;
-                                case 'F':
-                                    binaryDigits += "1111";
-                                    break;
-                            }
-                        }
-
-                        result = BigInt<2>(binaryDigits);
-
-                        return result;
-
-                        break;
-                    }
-
-                default:
-                    return BigInt<2>("00");
-                    break;
-            }
-
-            return result = BigInt<2>("00");
-            
-        }
-
-
-};
-
-// Check Methods
-
-template <size_t Base>
-bool BigInt<Base>::checkBase() {
-    if (Base == 2 || Base == 8 || Base == 10 || Base == 16)
-        return true;
-
-    return false;
-}
-
-template <size_t Base>
-bool BigInt<Base>::checkDigits(char digit) {
-    switch(Base) {
-        case 2:     
-            if (digit == '0' || digit == '1')
-                return true;
-            break;
-        case 8:
-            if (digit >= '0' && digit <= '7')
-                return true;
-            break;
-        case 10:
-            if (digit >= '0' && digit <= '9')
-                return true;
-            break;
-        case 16:
-            if ((digit >= '0' && digit <= '9') || (digit >= 'A' && digit <= 'F'))
-                return true;
-            break;
-        default:
-            break;
-    }
-    return false;
-}
-
-// Constructors
-
-template <size_t Base>
-BigInt<Base>::BigInt(long value) {
-    if(checkBase()) {
-        if (value < 0) {
-            sign_ = -1;
-            value = -value;
-        } else {
-            sign_ = 1;
-        }
-    } else {
-        std::cout << "Base is not supported" << std::endl;
-        exit(EXIT_FAILURE);
-    }
-
-    while(value > 0) {
-        if(checkDigits(value % 10 + '0')) 
-            digits_.push_back(value % 10 + '0');
-        else {
-            std::cout << "Digit is not supported" << std::endl;
-            exit(EXIT_FAILURE);
-        }
-        value /= 10;
-    }
-}
-
-template <size_t Base>
-BigInt<Base>::BigInt(std::string& value) {
-    if (checkBase()) {
-        if (value[0] == '-') {
-            sign_ = -1;
-            value = value.substr(1);
-        } else if (value[0] == '+') {
-            sign_ = 1;
-            value = value.substr(1);
-        } else if (regex_match(std::string(1, value[0]), std::regex("[0-9A-F]"))) {
-            sign_ = 1;
-        } else {
-            std::cout << "Invalid number" << std::endl;
-            exit(EXIT_FAILURE);
-        }
-    } else {
-        std::cout << "Base is not supported" << std::endl;
-        exit(EXIT_FAILURE);
-    }
-
-    for (int i = value.size() - 1; i >= 0; i--) {
-        if (checkDigits(value[i]))
-            digits_.push_back(value[i]);
-        else {
-            std::cout << "Digit is not supported" << std::endl;
-            exit(EXIT_FAILURE);
-        }
-    }
-}
-
-template <size_t Base>
-BigInt<Base>::BigInt(const char* value) {
-    // Convert char* to string
-    std::string str(value);
-    BigInt<Base> temp(str);
-    digits_ = temp.digits_;
-    sign_ = temp.sign_;
-}
-
-template <size_t Base>
-BigInt<Base>::BigInt(const BigInt<Base>& value) {
-    digits_ = value.digits_;
-    sign_ = value.sign_;
-}
-
-template <size_t Base>
-BigInt<Base>::~BigInt() {
-    digits_.clear();
-    sign_ = 0;
-}
-
-// Asignment Operators
-
-template <size_t Base>
-BigInt<Base>& BigInt<Base>::operator=(const BigInt<Base>& num) {
-    digits_ = num.digits_;
-    sign_ = num.sign_;
-    return *this;
-}
-
-// Flow operators
-template <size_t Base>
-std::ostream &operator<<(std::ostream &os, const BigInt<Base> &n) {
-  if (n.sign_ == -1)
-    os << "-";
-  for (int i = n.digits_.size() - 1; i >= 0; i--)
-    os << n.digits_[i];
-  return os;
-}
-
-template <size_t Base>
-std::istream &operator>>(std::istream &is, BigInt<Base> &n) {
-  std::string str;
-  is >> str;
-  n = BigInt<Base>(str);
-  return is;
-}
-
-// Accesor Methods
-
-template <size_t Base>
-int BigInt<Base>::sign() const {
-    return sign_;
-}
-
-template <size_t Base>
-char BigInt<Base>::operator[](int index) const {
-    int size = digits_.size();
-    if (index < 0 || index >= size) {
-        std::cout << "Index out of range" << std::endl;
-        exit(EXIT_FAILURE);
-    }
-    return digits_[index];
-}
-
-// Setters
-
-template <size_t Base>
-void BigInt<Base>::setSign(int sign) {
-    sign_ = sign;
-}
-
-
-// Comparison Operators
-
-template <size_t Base>
-bool operator==(const BigInt<Base>& num1, const BigInt<Base>& num2) {
-
-    bool num1_zero = true;
-    bool num2_zero = true;
-
-    for (int i = 0; i < num1.digits_.size(); i++) {
-        if (num1.digits_[i] != '0') {
-            num1_zero = false;
-            break;
-        }
-    }
-
-    for (int i = 0; i < num2.digits_.size(); i++) {
-        if (num2.digits_[i] != '0') {
-            num2_zero = false;
-            break;
-        }
-    }
-
-    if (num1_zero && num2_zero)
-        return true;
-    
-    if (num1.sign_ != num2.sign_)
-        return false;
-
-    if (num1.digits_.size() != num2.digits_.size())        
-        return false;
-
-    for (int i = 0; i < num1.digits_.size(); i++) {
-        if (num1.digits_[i] != num2.digits_[i])
-            return false;
-    }
-    return true;
-}
-
-template <size_t Base>
-bool BigInt<Base>::operator!=(const BigInt<Base>& num) const {
-    return !(*this == num);
-}
-
-template <size_t Base>
-bool operator>(const BigInt<Base>& num1, const BigInt<Base>& num2) {
-    if (num1.sign_ == -1 && num2.sign_ == 1)
-        return false;
-    if (num1.sign_ == 1 && num2.sign_ == -1)
-        return true;
-    if (num1.sign_ == 1 && num2.sign_ == 1) {
-        if (num1.digits_.size() > num2.digits_.size())
-            return true;
-        else if (num1.digits_.size() < num2.digits_.size())
-            return false;
-        else {
-            for (int i = num1.digits_.size() - 1; i >= 0; i--) {
-                if (num1[i] > num2[i])
-                    return true;
-                else if (num1[i] < num2[i])
-                    return false;
-            }
-        }
-    }
-  return false;
-}
-
-template <size_t Base>
-bool BigInt<Base>::operator>=(const BigInt<Base>& num) const {
-    return (*this > num || *this == num);
-}
-
-template <size_t Base>
-bool operator<(const BigInt<Base> &num1, const BigInt<Base> &num2) {
-  return !(num1 >= num2);
-}
-
-template <size_t Base>
-bool BigInt<Base>::operator<=(const BigInt<Base>& num) const {
-    return (*this < num || *this == num);
-}
-
-// Increment and Decrement Operators
-
-template <size_t Base>
-BigInt<Base>& BigInt<Base>::operator++() {
-    BigInt<Base> one(1);
-    *this = *this + one;
-    return *this;
-}
-
-template <size_t Base>
-BigInt<Base> BigInt<Base>::operator++(int) {
-    BigInt<Base> temp(*this);
-    ++(*this);
-    return temp;
-}
-
-template <size_t Base>
-BigInt<Base>& BigInt<Base>::operator--() {
-    BigInt<Base> one(1);
-    *this = *this - one;
-    return *this;
-}
-
-template <size_t Base>
-BigInt<Base> BigInt<Base>::operator--(int) {
-    BigInt<Base> temp(*this);
-    --(*this);
-    return temp;
-}
-
-// Arithmetic Operators
-
-template <size_t Base>
-BigInt<Base> operator+(const BigInt<Base> &n1, const BigInt<Base> &n2) {
-  BigInt<Base> result;
-
-  size_t carry = 0;
-  size_t i = 0;
-  size_t j = 0;
-
-  if (n1.sign() == -1 && n2.sign() == -1)
-  {
-    result.sign_ = -1;
-    while (i < n1.digits_.size() || j < n2.digits_.size())
-    {
-      int num1, num2;
-      if (i < n1.digits_.size())
-      {
-        if (n1[i] >= '0' && n1[i] <= '9')
-          num1 = n1[i] - '0';
-        else if (n1[i] >= 'A' && n1[i] <= 'F')
-          num1 = n1[i] - 'A' + 10;
-        i++;
-      }
-      else
-        num1 = 0;
-
-      if (j < n2.digits_.size())
-      {
-        if (n2[j] >= '0' && n2[j] <= '9')
-          num2 = n2[j] - '0';
-        else if (n2[j] >= 'A' && n2[j] <= 'F')
-          num2 = n2[j] - 'A' + 10;
-        j++;
-      }
-      else
-        num2 = 0;
-
-      int sum = num1 + num2 + carry;
-      carry = sum / Base;
-      sum = sum % Base;
-
-      if (sum >= 0 && sum <= 9)
-        result.digits_.push_back(sum + '0');
-      else if (sum >= 10 && sum <= 15)
-        result.digits_.push_back(sum - 10 + 'A');
-    }
-    if (carry > 0)
-      result.digits_.push_back(carry + '0');
-  }
-  else if (n1.sign() == 1 && n2.sign() == 1)
-  {
-    result.sign_ = 1;
-    while (i < n1.digits_.size() || j < n2.digits_.size())
-    {
-      int num1, num2;
-      if (i < n1.digits_.size())
-      {
-        if (n1[i] >= '0' && n1[i] <= '9')
-          num1 = n1[i] - '0';
-        else if (n1[i] >= 'A' && n1[i] <= 'F')
-          num1 = n1[i] - 'A' + 10;
-        i++;
-      }
-      else
-        num1 = 0;
-
-      if (j < n2.digits_.size())
-      {
-        if (n2[j] >= '0' && n2[j] <= '9')
-          num2 = n2[j] - '0';
-        else if (n2[j] >= 'A' && n2[j] <= 'F')
-          num2 = n2[j] - 'A' + 10;
-        j++;
-      }
-      else
-        num2 = 0;
-
-      int sum = num1 + num2 + carry;
-      carry = sum / Base;
-      sum = sum % Base;
-
-      if (sum >= 0 && sum <= 9)
-        result.digits_.push_back(sum + '0');
-      else if (sum >= 10 && sum <= 15)
-        result.digits_.push_back(sum - 10 + 'A');
-    }
-    if (carry > 0)
-      result.digits_.push_back(carry + '0');
-  }
-  else if (n1.sign() == -1 && n2.sign() == 1)
-  {
-    BigInt<Base> n1_copy(n1);
-    n1_copy.sign_ = 1;
-    result = n2 - n1_copy;
-  }
-  else if (n1.sign() == 1 && n2.sign() == -1)
-  {
-    BigInt<Base> n2_copy(n2);
-    n2_copy.sign_ = 1;
-    result = n1 - n2_copy;
-  }
-
-  return result;
-}
-
-template <size_t Base>
-BigInt<Base> BigInt<Base>::operator-(const BigInt<Base> &other) const {
-  BigInt<Base> result;
-
-  size_t carry = 0;
-  size_t i = 0;
-  size_t j = 0;
-
-  if (sign() == -1 && other.sign() == -1)
-  {
-    BigInt<Base> n1_copy(*this);
-    n1_copy.sign_ = 1;
-    BigInt<Base> n2_copy(other);
-    n2_copy.sign_ = 1;
-    result = n2_copy - n1_copy;
-  }
-  else if (sign() == 1 && other.sign() == 1)
-  {
-    BigInt<Base> n1_copy(*this);
-    BigInt<Base> n2_copy(other);
-    if (n1_copy < n2_copy)
-    {
-      result = n2_copy - n1_copy;
-      result.sign_ = -1;
-    }
-    else
-    {
-      result.sign_ = 1;
-      while (i < n1_copy.digits_.size() || j < n2_copy.digits_.size())
-      {
-        int num1, num2;
-        if (i < n1_copy.digits_.size())
-        {
-          if (n1_copy[i] >= '0' && n1_copy[i] <= '9')
-            num1 = n1_copy[i] - '0';
-          else if (n1_copy[i] >= 'A' && n1_copy[i] <= 'F')
-            num1 = n1_copy[i] - 'A' + 10;
-          i++;
-        }
-        else
-          num1 = 0;
-
-        if (j < n2_copy.digits_.size())
-        {
-          if (n2_copy[j] >= '0' && n2_copy[j] <= '9')
-            num2 = n2_copy[j] - '0';
-          else if (n2_copy[j] >= 'A' && n2_copy[j] <= 'F')
-            num2 = n2_copy[j] - 'A' + 10;
-          j++;
-        }
-        else
-          num2 = 0;
-
-        int sum = num1 - num2 - carry;
-        if (sum < 0)
-        {
-          sum += Base;
-          carry = 1;
-        }
-        else
-          carry = 0;
-
-        if (sum >= 0 && sum <= 9)
-          result.digits_.push_back(sum + '0');
-        else if (sum >= 10 && sum <= 15)
-          result.digits_.push_back(sum - 10 + 'A');
-      }
-    }
-  }
-  else if (sign() == -1 && other.sign() == 1)
-  {
-    BigInt<Base> n1_copy(*this);
-    n1_copy.sign_ = 1;
-    result = n1_copy + other;
-    result.sign_ = -1;
-  }
-  else if (sign() == 1 && other.sign() == -1)
-  {
-    BigInt<Base> n2_copy(other);
-    n2_copy.sign_ = 1;
-    result = *this + n2_copy;
-  }
-
-  if (result.digits_[result.digits_.size() - 1] == '0')
-    result.digits_.pop_back();
-
-  return result;
-}
-
-template <size_t Base>
-BigInt<Base> BigInt<Base>::operator-() const
-{
-  BigInt<Base> result(*this);
-  result.sign_ = -result.sign_;
-  return result;
-}
-
-
-template <size_t Base>
-BigInt<Base> BigInt<Base>::operator*(const BigInt<Base> &rhs) const
-{
-  BigInt<Base> result;
-  result.sign_ = sign_ * rhs.sign_;
-
-  BigInt<Base> n1 = *this;
-  BigInt<Base> n2 = rhs;
-
-  if (n1.sign() == -1)
-    n1 = -n1;
-  if (n2.sign() == -1)
-    n2 = -n2;
-
-  BigInt<Base> sum;
-
-  for (size_t i = 0; i < n2.digits_.size(); i++)
-  {
-    BigInt<Base> temp;
-    int carry = 0;
-    for (size_t j = 0; j < n1.digits_.size(); j++)
-    {
-      int num1 = n1[j] >= '0' && n1[j] <= '9' ? n1[j] - '0' : n1[j] - 'A' + 10;
-      int num2 = n2[i] >= '0' && n2[i] <= '9' ? n2[i] - '0' : n2[i] - 'A' + 10;
-      int prod = num1 * num2 + carry;
-      carry = prod / Base;
-      prod = prod % Base;
-      temp.digits_.push_back(prod >= 10 ? prod - 10 + 'A' : prod + '0');
-    }
-    if (carry > 0)
-      temp.digits_.push_back(carry >= 10 ? carry - 10 + 'A' : carry + '0');
-    for (size_t j = 0; j < i; j++)
-      temp.digits_.insert(temp.digits_.begin(), '0');
-    sum = sum + temp;
-  }
-
-  if (result.sign() == -1)
-    result = -sum;
-  else
-    result = sum;
-
-  return result;
-}
-
-template <size_t Base>
-BigInt<Base> operator/(const BigInt<Base> &dividend, const BigInt<Base> &divider) {
-
-    BigInt<Base> result;
-    BigInt<Base> n1 = dividend;
-    BigInt<Base> n2 = divider;
-    
-    if (n1.sign() == -1)
-        n1 = -n1;
-    if (n2.sign() == -1)
-        n2 = -n2;
-
-    if (n1 < n2) {
-
-        return BigInt<Base>("0");
-    }
-        
-    
-    BigInt<Base> temp;
-    for (int i = (int)n1.digits_.size() - 1; i >= 0; i--) {
-        temp.digits_.insert(temp.digits_.begin(), n1[i]);
-        int count = 0;
-        while (temp >= n2)
-        {
-        temp = temp - n2;
-        count++;
-        }
-        result.digits_.insert(result.digits_.begin(), (count >= 10) ? count - 10 + 'A' : count + '0');
-    }
-    
-    if (dividend.sign() == -1 && divider.sign() == -1)
-        result.sign_ = 1;
-    else if (dividend.sign() == -1 || divider.sign() == -1)
-        result.sign_ = -1;
-
-    // Si hay algun cero al final, se elimina
-    if (result.digits_[result.digits_.size() - 1] == '0')
-        result.digits_.pop_back();
-    
-    return result;
-}
-
-template <size_t Base>
-BigInt<Base> BigInt<Base>::operator%(const BigInt<Base> &rhs) const
-{
-  BigInt<Base> result;
-  BigInt<Base> n1 = *this;
-  BigInt<Base> n2 = rhs;
-
-  if (n1.sign() == -1)
-    n1 = -n1;
-  if (n2.sign() == -1)
-    n2 = -n2;
-
-  if (n1 < n2)
-    return n1;
-
-  BigInt<Base> temp;
-  for (int i = (int)n1.digits_.size() - 1; i >= 0; i--)
-  {
-    temp.digits_.insert(temp.digits_.begin(), n1[i]);
-    int count = 0;
-    while (temp >= n2)
-    {
-      temp = temp - n2;
-      count++;
-    }
-  }
-
-  if (sign() == -1)
-    result = -temp;
-  else
-    result = temp;
-
-  return result;
-}
-
-template <size_t Base>
-BigInt<Base> pow(const BigInt<Base> &a, const BigInt<Base> &b)
-{
-  if (b < BigInt<Base>(0L))
-  {
-    std::cerr << "Error: el exponente no puede ser negativo." << std::endl;
-    return BigInt<Base>();
-  }
-  BigInt<Base> res(1L);
-  for (BigInt<Base> i(0L); i < b; i = i + BigInt<Base>(1L))
-    res = res * a;
-
-  return res;
-}
-
+/**
+ * @file bigint.h
+ * @author Celeste Luis Díaz (alu0101321660@ull.edu.es)
+ * @brief Clase BigInt<Base> diseñada para la segunda práctica de 
+ * Algoritmos y Estructuras de Datos Avanazadas 2022-2023
+ * 
+ *         ** Impementación de la especialización para la base 2
+ *         ** Cambios de tipo incluidos.
+ *         ** Se realizan las operaciones mediante una calculadora RPN
+ * 
+ * @version 0.1
+ * @date 2023-03-01
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+ 
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <functional>
+#include <condition_variable>
+#include <utility>
+#include <math.h>
+
+// Tamaño (en palabras de 64 bits) del operando menor a partir del cual la
+// multiplicación binaria usa Karatsuba en lugar del producto palabra a palabra
+// (como mínimo 2)
+#ifndef BIGINT_KARATSUBA_THRESHOLD
+#define BIGINT_KARATSUBA_THRESHOLD 32
+#endif
+
+// Umbrales para Toom-3 y Toom-4, con el mismo criterio
+#ifndef BIGINT_TOOM3_THRESHOLD
+#define BIGINT_TOOM3_THRESHOLD 128
+#endif
+
+#ifndef BIGINT_TOOM4_THRESHOLD
+#define BIGINT_TOOM4_THRESHOLD 384
+#endif
+
+// A partir de este tamaño se multiplica con la transformada numérica (NTT)
+#ifndef BIGINT_NTT_THRESHOLD
+#define BIGINT_NTT_THRESHOLD 1536
+#endif
+
+// Tamaño del divisor (y del cociente) a partir del cual se divide con el
+// algoritmo recursivo de Burnikel-Ziegler en lugar de la división larga
+#ifndef BIGINT_BZ_THRESHOLD
+#define BIGINT_BZ_THRESHOLD 48
+#endif
+
+// Palabras de LimbBase a partir de las cuales el cambio de base se hace
+// partiendo el número por potencias LimbBase^(2^k) en lugar de con Horner
+#ifndef BIGINT_RADIX_THRESHOLD
+#define BIGINT_RADIX_THRESHOLD 32
+#endif
+
+// Hilos que reparten una multiplicación grande y que evalúan las líneas de
+// main (0: uno por núcleo)
+#ifndef BIGINT_THREADS
+#define BIGINT_THREADS 0
+#endif
+
+// Tamaño del operando menor a partir del cual Karatsuba y Toom-Cook calculan
+// sus productos parciales en paralelo. Por debajo se multiplica en serie
+#ifndef BIGINT_PARALLEL_THRESHOLD
+#define BIGINT_PARALLEL_THRESHOLD 768
+#endif
+
+// Elementos a partir de los cuales la NTT reparte sus mariposas entre hilos
+#ifndef BIGINT_NTT_PARALLEL_THRESHOLD
+#define BIGINT_NTT_PARALLEL_THRESHOLD 8192
+#endif
+
+// Con 0 los núcleos de suma, resta y comparación no usan AVX2 ni AVX-512
+#ifndef BIGINT_SIMD
+#define BIGINT_SIMD 1
+#endif
+
+#if BIGINT_SIMD && defined(__x86_64__) && defined(__GNUC__)
+#define BIGINT_X86_SIMD 1
+#include <immintrin.h>
+#else
+#define BIGINT_X86_SIMD 0
+#endif
+
+// Vector de palabras con las dos primeras dentro del propio objeto, de modo
+// que los números pequeños no reservan memoria. Al superarlas pasa a un
+// bloque en el montón que crece al doble. Solo tiene lo que usa BigInt
+class Limbs {
+    public:
+        static const size_t Inline = 2;
+
+        Limbs() : data_(inline_), size_(0), capacity_(Inline) {}
+        explicit Limbs(size_t count, uint64_t value = 0) : Limbs() { assign(count, value); }
+        Limbs(const Limbs& other) : Limbs() { *this = other; }
+        Limbs(Limbs&& other) noexcept : Limbs() { *this = std::move(other); }
+        ~Limbs() { release(); }
+
+        Limbs& operator=(const Limbs& other);
+        Limbs& operator=(Limbs&& other) noexcept;
+
+        size_t size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+        size_t capacity() const { return capacity_; }
+
+        uint64_t* data() { return data_; }
+        const uint64_t* data() const { return data_; }
+        uint64_t* begin() { return data_; }
+        const uint64_t* begin() const { return data_; }
+        uint64_t* end() { return data_ + size_; }
+        const uint64_t* end() const { return data_ + size_; }
+
+        uint64_t& operator[](size_t index) { return data_[index]; }
+        const uint64_t& operator[](size_t index) const { return data_[index]; }
+        uint64_t& back() { return data_[size_ - 1]; }
+        const uint64_t& back() const { return data_[size_ - 1]; }
+
+        void reserve(size_t count);
+        void shrink_to_fit();
+        void resize(size_t count, uint64_t value = 0);
+        void assign(size_t count, uint64_t value);
+        void push_back(uint64_t value);
+        void pop_back() { size_--; }
+        void clear() { size_ = 0; }
+        void swap(Limbs& other);
+
+        bool operator==(const Limbs& other) const {
+            return size_ == other.size_ && std::equal(begin(), end(), other.begin());
+        }
+        bool operator!=(const Limbs& other) const { return !(*this == other); }
+
+    private:
+        void release();
+
+        uint64_t* data_;
+        size_t size_;
+        size_t capacity_;
+        uint64_t inline_[Inline];
+};
+
+// Con capacidad suficiente se reutiliza la memoria propia
+Limbs& Limbs::operator=(const Limbs& other) {
+    if (this != &other) {
+        size_ = 0;
+        reserve(other.size_);
+        std::copy(other.begin(), other.end(), data_);
+        size_ = other.size_;
+    }
+    return *this;
+}
+
+// Un bloque del montón se cede; las palabras internas se copian
+Limbs& Limbs::operator=(Limbs&& other) noexcept {
+    if (this == &other) {
+        return *this;
+    }
+    if (other.data_ == other.inline_) {
+        size_ = 0;
+        reserve(other.size_);
+        std::copy(other.begin(), other.end(), data_);
+    } else {
+        release();
+        data_ = other.data_;
+        capacity_ = other.capacity_;
+        other.data_ = other.inline_;
+        other.capacity_ = Inline;
+    }
+    size_ = other.size_;
+    other.size_ = 0;
+    return *this;
+}
+
+void Limbs::release() {
+    if (data_ != inline_) {
+        delete[] data_;
+    }
+    data_ = inline_;
+    capacity_ = Inline;
+}
+
+void Limbs::reserve(size_t count) {
+    if (count <= capacity_) {
+        return;
+    }
+    size_t capacity = std::max(count, 2 * capacity_);
+    uint64_t* data = new uint64_t[capacity];
+    std::copy(begin(), end(), data);
+    size_t size = size_;
+    release();
+    data_ = data;
+    size_ = size;
+    capacity_ = capacity;
+}
+
+// Deja la capacidad justa: vuelve a las palabras internas si caben en ellas
+void Limbs::shrink_to_fit() {
+    if (data_ == inline_ || capacity_ == size_) {
+        return;
+    }
+    uint64_t* data = size_ <= Inline ? inline_ : new uint64_t[size_];
+    std::copy(begin(), end(), data);
+    delete[] data_;
+    data_ = data;
+    capacity_ = size_ <= Inline ? Inline : size_;
+}
+
+void Limbs::resize(size_t count, uint64_t value) {
+    reserve(count);
+    if (count > size_) {
+        std::fill(data_ + size_, data_ + count, value);
+    }
+    size_ = count;
+}
+
+void Limbs::assign(size_t count, uint64_t value) {
+    size_ = 0;
+    resize(count, value);
+}
+
+void Limbs::push_back(uint64_t value) {
+    reserve(size_ + 1);
+    data_[size_++] = value;
+}
+
+void Limbs::swap(Limbs& other) {
+    Limbs temp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(temp);
+}
+
+// Repartidor de tareas con robo de trabajo. Cada hilo del repartidor tiene su
+// cola, en la que añade y de la que saca por el final; sin tareas propias roba
+// del principio de las demás. Los hilos ajenos (el principal o los de main)
+// dejan sus tareas en una cola compartida. Quien espera a un grupo ejecuta
+// tareas mientras tanto, así que las esperas anidadas no se bloquean
+class TaskPool {
+    public:
+        // Tareas lanzadas con run() y esperadas con wait()
+        class Group {
+            public:
+                void run(std::function<void()> task);
+                void wait();
+            private:
+                std::atomic<size_t> pending_{0};
+        };
+
+        static TaskPool& instance();
+        static bool parallel();
+        static size_t size();
+
+    private:
+        struct Queue {
+            std::mutex mutex;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        explicit TaskPool(size_t threads);
+        static size_t& current();
+        void push(std::function<void()> task);
+        bool runOne();
+        void work(size_t index);
+
+        size_t threads_;
+        std::deque<Queue> queues_;          // queues_[threads_] es la compartida
+        std::atomic<size_t> queued_{0};
+        std::mutex mutex_;
+        std::condition_variable wake_;
+};
+
+// Los hilos no terminan nunca: el repartidor no se destruye, de modo que un
+// exit() desde cualquier hilo no espera a tareas a medias
+TaskPool& TaskPool::instance() {
+    static TaskPool* pool = new TaskPool(size());
+    return *pool;
+}
+
+bool TaskPool::parallel() {
+    return instance().threads_ > 1;
+}
+
+// Número de hilos, el principal incluido: BIGINT_THREADS o uno por núcleo
+size_t TaskPool::size() {
+    return BIGINT_THREADS > 0 ? BIGINT_THREADS : std::max(1u, std::thread::hardware_concurrency());
+}
+
+// El hilo que llama también trabaja, así que se lanzan threads - 1 hilos
+TaskPool::TaskPool(size_t threads) : threads_(threads), queues_(threads + 1) {
+    for (size_t i = 1; i < threads; i++) {
+        std::thread(&TaskPool::work, this, i).detach();
+    }
+}
+
+// Cola del hilo actual, o la compartida si no es del repartidor
+size_t& TaskPool::current() {
+    static thread_local size_t index = (size_t)-1;
+    return index;
+}
+
+void TaskPool::push(std::function<void()> task) {
+    size_t index = current() < threads_ ? current() : threads_;
+    {
+        std::lock_guard<std::mutex> lock(queues_[index].mutex);
+        queues_[index].tasks.push_back(std::move(task));
+    }
+    queued_++;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+    }
+    wake_.notify_one();
+}
+
+// Ejecuta una tarea: primero la última propia, después la primera de la cola
+// compartida y de las de los demás hilos. Devuelve false si no había ninguna
+bool TaskPool::runOne() {
+
+    std::function<void()> task;
+    size_t own = current();
+
+    for (size_t i = 0; i <= threads_ && !task; i++) {
+        size_t index = own < threads_ ? (own + i) % (threads_ + 1) : (threads_ + i) % (threads_ + 1);
+        Queue& queue = queues_[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) {
+            continue;
+        }
+        if (index == own) {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        } else {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+    }
+
+    if (!task) {
+        return false;
+    }
+    queued_--;
+    task();
+    return true;
+}
+
+void TaskPool::work(size_t index) {
+    current() = index;
+    while (true) {
+        if (!runOne()) {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [this]() { return queued_ > 0; });
+        }
+    }
+}
+
+// La última tarea de un grupo despierta a quien lo espera. Tras restar ya no
+// se toca el grupo, que quien espera puede haber destruido
+void TaskPool::Group::run(std::function<void()> task) {
+    pending_++;
+    instance().push([this, task]() {
+        task();
+        if (--pending_ == 0) {
+            TaskPool& pool = instance();
+            {
+                std::lock_guard<std::mutex> lock(pool.mutex_);
+            }
+            pool.wake_.notify_all();
+        }
+    });
+}
+
+// Sin tareas que robar se duerme hasta que el grupo termina o se encola otra
+void TaskPool::Group::wait() {
+    TaskPool& pool = instance();
+    while (pending_ > 0) {
+        if (!pool.runOne()) {
+            std::unique_lock<std::mutex> lock(pool.mutex_);
+            pool.wake_.wait(lock, [&]() { return pending_ == 0 || pool.queued_ > 0; });
+        }
+    }
+}
+
+// Núcleos O(n) sobre palabras de 64 bits: suma y resta con acarreo,
+// comparación de magnitudes de la misma longitud y producto por una palabra
+// acumulado. La primera vez que se usan se elige según CPUID la versión
+// AVX-512, la AVX2 o la escalar (MULX/ADX o __int128 para el producto), que
+// es la única fuera de x86-64 o con BIGINT_SIMD a 0.
+//
+// La suma vectorial calcula todas las palabras a la vez y resuelve los
+// acarreos entre ellas con una suma de máscaras: G marca las palabras que
+// desbordan y P las que valen todo unos y dejan pasar el acarreo que les
+// llega. Los acarreos que entran en cada palabra son ((G << 1 | c) + P) ^ P.
+// El producto con ADX lleva dos cadenas de acarreo independientes, una en CF
+// (adcx) para las palabras altas de los productos y otra en OF (adox) para r
+class Kernels {
+    public:
+        // r = a + b + carry (a - b - carry en sub) en n palabras. r puede ser
+        // a o b. Devuelve el acarreo (el préstamo) que sale
+        typedef uint64_t (*AddFunction)(uint64_t* r, const uint64_t* a, const uint64_t* b, size_t n, uint64_t carry);
+        // -1, 0 o 1 comparando a y b, de n palabras, desde la más alta
+        typedef int (*CompareFunction)(const uint64_t* a, const uint64_t* b, size_t n);
+        // r += a · b en n palabras. Devuelve la palabra que sale
+        typedef uint64_t (*MulFunction)(uint64_t* r, const uint64_t* a, size_t n, uint64_t b);
+
+        AddFunction add;
+        AddFunction sub;
+        CompareFunction compare;
+        MulFunction addmul;
+
+        static const Kernels& instance();
+
+    private:
+        Kernels();
+
+        static uint64_t addScalar(uint64_t* r, const uint64_t* a, const uint64_t* b, size_t n, uint64_t carry);
+        static uint64_t subScalar(uint64_t* r, const uint64_t* a, const uint64_t* b, size_t n, uint64_t borrow);
+        static int compareScalar(const uint64_t* a, const uint64_t* b, size_t n);
+        static uint64_t addmulScalar(uint64_t* r, const uint64_t* a, size_t n, uint64_t b);
+
+#if BIGINT_X86_SIMD
+        __attribute__((target("avx2"))) static uint64_t addAVX2(uint64_t* r, const uint64_t* a, const uint64_t* b, size_t n, uint64_t carry);
+        __attribute__((target("avx2"))) static uint64_t subAVX2(uint64_t* r, const uint64_t* a, const uint64_t* b, size_t n, uint64_t borrow);
+        __attribute__((target("avx2"))) static int compareAVX2(const uint64_t* a, const uint64_t* b, size_t n);
+        __attribute__((target("avx512f"))) static uint64_t addAVX512(uint64_t* r, const uint64_t* a, const uint64_t* b, size_t n, uint64_t carry);
+        __attribute__((target("avx512f"))) static uint64_t subAVX512(uint64_t* r, const uint64_t* a, const uint64_t* b, size_t n, uint64_t borrow);
+        __attribute__((target("avx512f"))) static int compareAVX512(const uint64_t* a, const uint64_t* b, size_t n);
+        __attribute__((target("bmi2,adx"))) static uint64_t addmulADX(uint64_t* r, const uint64_t* a, size_t n, uint64_t b);
+#endif
+};
+
+const Kernels& Kernels::instance() {
+    static const Kernels kernels;
+    return kernels;
+}
+
+Kernels::Kernels() : add(addScalar), sub(subScalar), compare(compareScalar), addmul(addmulScalar) {
+#if BIGINT_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("bmi2") && __builtin_cpu_supports("adx")) {
+        addmul = addmulADX;
+    }
+    if (__builtin_cpu_supports("avx512f")) {
+        add = addAVX512;
+        sub = subAVX512;
+        compare = compareAVX512;
+    } else if (__builtin_cpu_supports("avx2")) {
+        add = addAVX2;
+        sub = subAVX2;
+        compare = compareAVX2;
+    }
+#endif
+}
+
+uint64_t Kernels::addScalar(uint64_t* r, const uint64_t* a, const uint64_t* b, size_t n, uint64_t carry) {
+    for (size_t i = 0; i < n; i++) {
+        uint64_t sum = a[i] + b[i];
+        uint64_t overflow = sum < a[i];
+        sum += carry;
+        carry = overflow | (sum < carry);
+        r[i] = sum;
+    }
+    return carry;
+}
+
+uint64_t Kernels::subScalar(uint64_t* r, const uint64_t* a, const uint64_t* b, size_t n, uint64_t borrow) {
+    for (size_t i = 0; i < n; i++) {
+        uint64_t diff = a[i] - b[i];
+        uint64_t underflow = (a[i] < b[i]) | (diff < borrow);
+        r[i] = diff - borrow;
+        borrow = underflow;
+    }
+    return borrow;
+}
+
+int Kernels::compareScalar(const uint64_t* a, const uint64_t* b, size_t n) {
+    for (size_t i = n; i-- > 0;) {
+        if (a[i] != b[i]) {
+            return a[i] > b[i] ? 1 : -1;
+        }
+    }
+    return 0;
+}
+
+uint64_t Kernels::addmulScalar(uint64_t* r, const uint64_t* a, size_t n, uint64_t b) {
+    uint64_t carry = 0;
+    for (size_t i = 0; i < n; i++) {
+        unsigned __int128 product = (unsigned __int128)a[i] * b + r[i] + carry;
+        r[i] = (uint64_t)product;
+        carry = (uint64_t)(product >> 64);
+    }
+    return carry;
+}
+
+#if BIGINT_X86_SIMD
+
+// AVX2 no compara sin signo: se invierte el bit alto de los dos operandos
+uint64_t Kernels::addAVX2(uint64_t* r, const uint64_t* a, const uint64_t* b, size_t n, uint64_t carry) {
+    const __m256i ones = _mm256_set1_epi64x(-1);
+    const __m256i high = _mm256_set1_epi64x(INT64_MIN);
+    const __m256i lanes = _mm256_setr_epi64x(0, 1, 2, 3);
+    const __m256i one = _mm256_set1_epi64x(1);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        __m256i sum = _mm256_add_epi64(x, y);
+        __m256i g = _mm256_cmpgt_epi64(_mm256_xor_si256(x, high), _mm256_xor_si256(sum, high));
+        __m256i p = _mm256_cmpeq_epi64(sum, ones);
+        unsigned gm = _mm256_movemask_pd(_mm256_castsi256_pd(g));
+        unsigned pm = _mm256_movemask_pd(_mm256_castsi256_pd(p));
+        unsigned carries = (((gm << 1) | (unsigned)carry) + pm) ^ pm;
+        __m256i c = _mm256_and_si256(_mm256_srlv_epi64(_mm256_set1_epi64x(carries), lanes), one);
+        _mm256_storeu_si256((__m256i*)(r + i), _mm256_add_epi64(sum, c));
+        carry = carries >> 4;
+    }
+    return addScalar(r + i, a + i, b + i, n - i, carry);
+}
+
+// En la resta G marca las palabras con préstamo y P las que quedan a cero
+uint64_t Kernels::subAVX2(uint64_t* r, const uint64_t* a, const uint64_t* b, size_t n, uint64_t borrow) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i high = _mm256_set1_epi64x(INT64_MIN);
+    const __m256i lanes = _mm256_setr_epi64x(0, 1, 2, 3);
+    const __m256i one = _mm256_set1_epi64x(1);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        __m256i diff = _mm256_sub_epi64(x, y);
+        __m256i g = _mm256_cmpgt_epi64(_mm256_xor_si256(y, high), _mm256_xor_si256(x, high));
+        __m256i p = _mm256_cmpeq_epi64(diff, zero);
+        unsigned gm = _mm256_movemask_pd(_mm256_castsi256_pd(g));
+        unsigned pm = _mm256_movemask_pd(_mm256_castsi256_pd(p));
+        unsigned borrows = (((gm << 1) | (unsigned)borrow) + pm) ^ pm;
+        __m256i c = _mm256_and_si256(_mm256_srlv_epi64(_mm256_set1_epi64x(borrows), lanes), one);
+        _mm256_storeu_si256((__m256i*)(r + i), _mm256_sub_epi64(diff, c));
+        borrow = borrows >> 4;
+    }
+    return subScalar(r + i, a + i, b + i, n - i, borrow);
+}
+
+int Kernels::compareAVX2(const uint64_t* a, const uint64_t* b, size_t n) {
+    size_t i = n;
+    for (; i >= 4; i -= 4) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i - 4));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i - 4));
+        unsigned equal = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(x, y)));
+        if (equal != 0xF) {
+            size_t j = i - 4 + (31 - __builtin_clz(~equal & 0xF));
+            return a[j] > b[j] ? 1 : -1;
+        }
+    }
+    return compareScalar(a, b, i);
+}
+
+uint64_t Kernels::addAVX512(uint64_t* r, const uint64_t* a, const uint64_t* b, size_t n, uint64_t carry) {
+    const __m512i ones = _mm512_set1_epi64(-1);
+    const __m512i one = _mm512_set1_epi64(1);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512i x = _mm512_loadu_si512(a + i);
+        __m512i y = _mm512_loadu_si512(b + i);
+        __m512i sum = _mm512_add_epi64(x, y);
+        unsigned g = _mm512_cmplt_epu64_mask(sum, x);
+        unsigned p = _mm512_cmpeq_epu64_mask(sum, ones);
+        unsigned carries = (((g << 1) | (unsigned)carry) + p) ^ p;
+        _mm512_storeu_si512(r + i, _mm512_mask_add_epi64(sum, (__mmask8)carries, sum, one));
+        carry = carries >> 8;
+    }
+    return addScalar(r + i, a + i, b + i, n - i, carry);
+}
+
+uint64_t Kernels::subAVX512(uint64_t* r, const uint64_t* a, const uint64_t* b, size_t n, uint64_t borrow) {
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i one = _mm512_set1_epi64(1);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512i x = _mm512_loadu_si512(a + i);
+        __m512i y = _mm512_loadu_si512(b + i);
+        __m512i diff = _mm512_sub_epi64(x, y);
+        unsigned g = _mm512_cmplt_epu64_mask(x, y);
+        unsigned p = _mm512_cmpeq_epu64_mask(diff, zero);
+        unsigned borrows = (((g << 1) | (unsigned)borrow) + p) ^ p;
+        _mm512_storeu_si512(r + i, _mm512_mask_sub_epi64(diff, (__mmask8)borrows, diff, one));
+        borrow = borrows >> 8;
+    }
+    return subScalar(r + i, a + i, b + i, n - i, borrow);
+}
+
+int Kernels::compareAVX512(const uint64_t* a, const uint64_t* b, size_t n) {
+    size_t i = n;
+    for (; i >= 8; i -= 8) {
+        __m512i x = _mm512_loadu_si512(a + i - 8);
+        __m512i y = _mm512_loadu_si512(b + i - 8);
+        unsigned diff = _mm512_cmpneq_epu64_mask(x, y);
+        if (diff != 0) {
+            size_t j = i - 8 + (31 - __builtin_clz(diff));
+            return a[j] > b[j] ? 1 : -1;
+        }
+    }
+    return compareScalar(a, b, i);
+}
+
+// De cuatro en cuatro palabras: los cuatro productos con MULX y después
+// las dos cadenas de acarreo. La palabra alta del último producto recoge
+// los dos acarreos finales sin desbordar, porque r + a · b cabe en n + 1
+// palabras
+uint64_t Kernels::addmulADX(uint64_t* r, const uint64_t* a, size_t n, uint64_t b) {
+    unsigned long long high = 0;
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        unsigned long long h0, h1, h2, h3;
+        unsigned long long l0 = _mulx_u64(a[i], b, &h0);
+        unsigned long long l1 = _mulx_u64(a[i + 1], b, &h1);
+        unsigned long long l2 = _mulx_u64(a[i + 2], b, &h2);
+        unsigned long long l3 = _mulx_u64(a[i + 3], b, &h3);
+        __asm__(
+            "xorl %%eax, %%eax\n\t"
+            "adcx %[high], %[l0]\n\t"
+            "adcx %[h0], %[l1]\n\t"
+            "adcx %[h1], %[l2]\n\t"
+            "adcx %[h2], %[l3]\n\t"
+            "adcx %%rax, %[h3]\n\t"
+            "adox 0(%[r]), %[l0]\n\t"
+            "adox 8(%[r]), %[l1]\n\t"
+            "adox 16(%[r]), %[l2]\n\t"
+            "adox 24(%[r]), %[l3]\n\t"
+            "adox %%rax, %[h3]\n\t"
+            "movq %[l0], 0(%[r])\n\t"
+            "movq %[l1], 8(%[r])\n\t"
+            "movq %[l2], 16(%[r])\n\t"
+            "movq %[l3], 24(%[r])"
+            : [l0] "+&r"(l0), [l1] "+&r"(l1), [l2] "+&r"(l2), [l3] "+&r"(l3), [h3] "+&r"(h3)
+            : [high] "r"(high), [h0] "r"(h0), [h1] "r"(h1), [h2] "r"(h2), [r] "r"(r + i)
+            : "rax", "cc", "memory");
+        high = h3;
+    }
+    for (; i < n; i++) {
+        unsigned __int128 product = (unsigned __int128)a[i] * b + r[i] + high;
+        r[i] = (uint64_t)product;
+        high = (uint64_t)(product >> 64);
+    }
+    return high;
+}
+
+#endif
+
+template <size_t Base>
+class BigInt;
+
+// Flow Operators
+template <size_t Base> std::ostream &operator<<(std::ostream &, const BigInt<Base> &);
+template <size_t Base> std::istream &operator>>(std::istream &, BigInt<Base> &);
+
+// Comparison Operators
+template <size_t Base> bool operator==(const BigInt<Base>&, const BigInt<Base>&);
+template <size_t Base> bool operator>(const BigInt<Base>&, const BigInt<Base>&);
+template <size_t Base> bool operator<(const BigInt<Base>&, const BigInt<Base>&);
+
+// Arithmetic Operators
+template <size_t Base> BigInt<Base> operator+(const BigInt<Base>&, const BigInt<Base>&);
+template <size_t Base> BigInt<Base> operator/(const BigInt<Base>&, const BigInt<Base>&);
+template <size_t Base> BigInt<Base> operator+(BigInt<Base>&&, const BigInt<Base>&);
+template <size_t Base> BigInt<Base> operator+(const BigInt<Base>&, BigInt<Base>&&);
+template <size_t Base> BigInt<Base> operator+(BigInt<Base>&&, BigInt<Base>&&);
+template <size_t Base> BigInt<Base> operator-(BigInt<Base>&&, const BigInt<Base>&);
+template <size_t Base> BigInt<Base> operator-(const BigInt<Base>&, BigInt<Base>&&);
+template <size_t Base> BigInt<Base> operator-(BigInt<Base>&&, BigInt<Base>&&);
+template <size_t Base> BigInt<Base> operator-(BigInt<Base>&&);
+
+// Cociente y resto en una sola división
+template <size_t Base> std::pair<BigInt<Base>, BigInt<Base>> divmod(const BigInt<Base>&, const BigInt<Base>&);
+
+// Pow
+template <size_t Base> BigInt<Base> pow(const BigInt<Base>&, const BigInt<Base>&);
+
+// Espcialización de la clase BigInt para la base 2
+
+template <> std::ostream &operator<<(std::ostream &, const BigInt<2> &);
+template <> std::istream &operator>>(std::istream &, BigInt<2> &);
+template <> bool operator==(const BigInt<2>&, const BigInt<2>&);
+template <> bool operator>(const BigInt<2>&, const BigInt<2>&);
+template <> bool operator<(const BigInt<2>&, const BigInt<2>&);
+template <> BigInt<2> operator+(const BigInt<2>&, const BigInt<2>&);
+template <> BigInt<2> operator/(const BigInt<2>&, const BigInt<2>&);
+template <> BigInt<2> pow(const BigInt<2>&, const BigInt<2>&);
+
+template <>
+class BigInt<2> {
+
+    private:
+        // Magnitud en palabras de 64 bits, la menos significativa primero y
+        // sin palabras altas a cero, y signo aparte (1 si es negativo). El
+        // cero no tiene palabras y su signo es 0. El complemento a dos solo
+        // aparece en el texto de entrada y salida y en las operaciones bit a bit
+        Limbs limbs_;
+        int sign_ = 0;
+
+        // Límite de palabras que puede añadir un desplazamiento a la izquierda
+        // (2^28 palabras, 2 GiB); por encima se sale con "Shift too large"
+        static const size_t MaxShiftWords = (size_t)1 << 28;
+
+        void parse(const char* value, size_t length);
+        void normalize();
+        uint64_t extension() const;
+        void complement(Limbs& words) const;
+        void fromComplement();
+        uint64_t bits(size_t position, size_t count) const;
+        size_t bitLength() const;
+
+        void negate();
+
+        // Camino rápido para los valores que caben en un int64_t
+        bool toWord(int64_t& value) const;
+        void assignWord(int64_t value);
+
+        static void addWords(BigInt<2>& result, const BigInt<2>&, const BigInt<2>&, bool subtract);
+        static BigInt<2> bitwiseWords(const BigInt<2>&, const BigInt<2>&, char op);
+
+        static uint64_t addTo(uint64_t* r, size_t rn, const uint64_t* a, size_t an);
+        static uint64_t subFrom(uint64_t* r, size_t rn, const uint64_t* a, size_t an);
+        static void mulWords(uint64_t* r, const uint64_t* a, size_t an, const uint64_t* b, size_t bn);
+        static void mulBasecase(uint64_t* r, const uint64_t* a, size_t an, const uint64_t* b, size_t bn);
+        static void sqrBasecase(uint64_t* r, const uint64_t* a, size_t an);
+        static void mulKaratsuba(uint64_t* r, const uint64_t* a, size_t an, const uint64_t* b, size_t bn);
+        static void mulToom3(uint64_t* r, const uint64_t* a, size_t an, const uint64_t* b, size_t bn);
+        static void mulToom4(uint64_t* r, const uint64_t* a, size_t an, const uint64_t* b, size_t bn);
+        static void mulUnbalanced(uint64_t* r, const uint64_t* a, size_t an, const uint64_t* b, size_t bn);
+        static void mulNTT(uint64_t* r, const uint64_t* a, size_t an, const uint64_t* b, size_t bn);
+        static void convolution(std::vector<uint64_t>& data, size_t n, const uint64_t* a, size_t an, const uint64_t* b, size_t bn, const uint64_t* prime, uint64_t& inverse, uint64_t& square);
+        static void transform(uint64_t* data, size_t n, const uint64_t* roots, size_t stride, uint64_t modulus, uint64_t inverse, bool backward);
+        static void butterflies(uint64_t* data, size_t half, size_t from, size_t to, const uint64_t* roots, size_t stride, uint64_t modulus, uint64_t inverse, bool backward);
+        static uint64_t montMul(uint64_t a, uint64_t b, uint64_t modulus, uint64_t inverse);
+        static uint64_t powMod(uint64_t base, uint64_t exponent, uint64_t modulus);
+
+        static void divWords(const uint64_t* u, size_t un, const uint64_t* v, size_t vn, uint64_t* q, uint64_t* r);
+        static void divBasecase(const uint64_t* u, size_t un, const uint64_t* v, size_t vn, uint64_t* q, uint64_t* r);
+        static void divRecursive(const uint64_t* u, size_t un, const uint64_t* v, size_t vn, uint64_t* q, uint64_t* r);
+        static void div2n1n(const uint64_t* a, const uint64_t* b, size_t n, uint64_t* q, uint64_t* r);
+        static void div3n2n(const uint64_t* a, const uint64_t* b, size_t n, uint64_t* q, uint64_t* r);
+        static void divide(const BigInt<2>& dividend, const BigInt<2>& divisor, BigInt<2>* quotient, BigInt<2>* remainder);
+        static BigInt<2> mulMagnitudes(const BigInt<2>& num1, const BigInt<2>& num2, bool negative);
+        static int compareWords(const uint64_t* a, size_t an, const uint64_t* b, size_t bn);
+        static bool absDiff(uint64_t* r, const uint64_t* a, size_t an, const uint64_t* b, size_t bn);
+
+        // Magnitud con signo para las evaluaciones e interpolaciones de Toom-Cook
+        struct Signed {
+            std::vector<uint64_t> words;
+            bool negative = false;
+        };
+
+        static Signed toSigned(const uint64_t* a, size_t an);
+        static void addSigned(Signed& r, const Signed& a, bool subtract = false);
+        static Signed mulSigned(const Signed& a, const Signed& b);
+        static void mulPoints(Signed* w, const Signed* const* left, const Signed* const* right, size_t count, bool parallel);
+        static void shiftSigned(Signed& r, int shift);
+        static void divExactSigned(Signed& r, uint64_t divisor);
+        static void addCoefficients(uint64_t* r, size_t rn, const Signed* coefficients, size_t count, size_t k);
+
+        template <size_t> friend class BigInt;
+
+    public:
+        BigInt(long value = 0);
+        BigInt(std::string& value);
+        BigInt(const char* value);
+        BigInt(const BigInt<2>& value);
+        BigInt(BigInt<2>&& value) noexcept;
+        BigInt(std::vector<bool> digits);
+        ~BigInt() = default;
+
+        // Asignment Operators
+        BigInt<2>& operator=(const BigInt<2>& num);
+        BigInt<2>& operator=(BigInt<2>&& num) noexcept;
+
+        // Flow Operators
+        friend std::ostream &operator<<(std::ostream &, const BigInt<2> &);
+        friend std::istream &operator>>(std::istream &, BigInt<2> &);
+
+        // Accesor Methods
+        int sign() const; 
+        char operator[](int) const; 
+        std::vector<bool> digits() const;
+        void setSign(int sign);
+        void setDigits(std::vector<bool> digits);
+        void setPosition(int position, bool value);
+
+        // Mensaje del error con el que saldrían los constructores, o nullptr
+        static const char* check(const std::string& value);
+
+        // Libera la memoria que el valor ya no usa
+        void shrink_to_fit();
+
+        // Comparison Operators
+        int compare(const BigInt<2>& num) const;
+        friend bool operator==(const BigInt<2>& num1, const BigInt<2>& num2);
+        bool operator!=(const BigInt<2>& num) const;
+        friend bool operator>(const BigInt<2>& num1, const BigInt<2>& num2);
+        bool operator>=(const BigInt<2>& num) const;
+        friend bool operator< (const BigInt<2>& num1, const BigInt<2>& num2);
+        bool operator<=(const BigInt<2>& num) const;
+
+        // Increment and Decrement Operators
+        BigInt<2>& operator++(); 
+        BigInt<2> operator++(int value); 
+        BigInt<2>& operator--(); 
+        BigInt<2> operator--(int value); 
+
+        // Arithmetic Operators
+        friend BigInt<2> operator+(const BigInt<2>&, const BigInt<2>&);
+        BigInt<2> operator-(const BigInt<2> &) const;
+        BigInt<2> operator-() const;
+        BigInt<2> operator*(const BigInt<2>&) const;
+        friend BigInt<2> operator/(const BigInt<2>&, const BigInt<2>&);
+        BigInt<2> operator%(const BigInt<2>&) const;
+
+        // Con un operando temporal el resultado se calcula en su memoria
+        friend BigInt<2> operator+(BigInt<2>&&, const BigInt<2>&);
+        friend BigInt<2> operator+(const BigInt<2>&, BigInt<2>&&);
+        friend BigInt<2> operator+(BigInt<2>&&, BigInt<2>&&);
+        friend BigInt<2> operator-(BigInt<2>&&, const BigInt<2>&);
+        friend BigInt<2> operator-(const BigInt<2>&, BigInt<2>&&);
+        friend BigInt<2> operator-(BigInt<2>&&, BigInt<2>&&);
+        friend BigInt<2> operator-(BigInt<2>&&);
+        friend std::pair<BigInt<2>, BigInt<2>> divmod(const BigInt<2>&, const BigInt<2>&);
+
+        // Compound Assignment Operators (sobre la memoria del propio número)
+        BigInt<2>& operator+=(const BigInt<2>&);
+        BigInt<2>& operator-=(const BigInt<2>&);
+        BigInt<2>& operator*=(const BigInt<2>&);
+        BigInt<2>& operator/=(const BigInt<2>&);
+        BigInt<2>& operator%=(const BigInt<2>&);
+        BigInt<2>& operator<<=(size_t shift);
+        BigInt<2>& operator>>=(size_t shift);
+        BigInt<2>& operator<<=(const BigInt<2>& shift);
+        BigInt<2>& operator>>=(const BigInt<2>& shift);
+
+        // Shift and Bitwise Operators (complemento a dos, >> es aritmético)
+        BigInt<2> operator<<(size_t shift) const;
+        BigInt<2> operator>>(size_t shift) const;
+        BigInt<2> operator<<(const BigInt<2>& shift) const;
+        BigInt<2> operator>>(const BigInt<2>& shift) const;
+        bool leftShiftFits(const BigInt<2>& shift) const;
+        BigInt<2> operator&(const BigInt<2>&) const;
+        BigInt<2> operator|(const BigInt<2>&) const;
+        BigInt<2> operator^(const BigInt<2>&) const;
+        BigInt<2> operator~() const;
+
+        // Pow
+        friend BigInt<2> pow(const BigInt<2>&, const BigInt<2>&);
+
+        BigInt<2> complementTwo() const;
+        BigInt<2> abs() const;
+
+        template<size_t Base> operator BigInt<Base>() const;
+
+        //ToString
+        std::string toString() const;
+
+        // Binary to Octal
+        std::string binaryToOctal(std::string binaryStr);
+};
+
+BigInt<2>::BigInt(long value) {
+    assignWord(value);
+}
+
+BigInt<2>::BigInt(std::string& value) {
+    parse(value.c_str(), value.size());
+}
+
+BigInt<2>::BigInt(const char* value) {
+    parse(value, strlen(value));
+}
+
+BigInt<2>::BigInt(const BigInt<2>& value) {
+    limbs_ = value.limbs_;
+    sign_ = value.sign_;
+}
+
+// El número movido queda a cero
+BigInt<2>::BigInt(BigInt<2>&& value) noexcept : limbs_(std::move(value.limbs_)), sign_(value.sign_) {
+    value.limbs_.clear();
+    value.sign_ = 0;
+}
+
+BigInt<2>::BigInt(std::vector<bool> digits) {
+    setDigits(digits);
+}
+
+// El primer carácter es el bit de signo y el resto el cuerpo del número en
+// complemento a dos, del bit más significativo al menos significativo
+void BigInt<2>::parse(const char* value, size_t length) {
+
+    sign_ = (length > 0 && value[0] != '0') ? 1 : 0;
+
+    size_t size = length > 0 ? length - 1 : 0;
+    limbs_.assign((size + 63) / 64, 0);
+
+    for (size_t i = 0; i < size; i++) {
+        if (value[length - 1 - i] != '0') {
+            limbs_[i / 64] |= uint64_t(1) << (i % 64);
+        }
+    }
+
+    // Extender el signo en la palabra más alta
+    if (sign_ == 1 && size % 64 != 0) {
+        limbs_.back() |= ~uint64_t(0) << (size % 64);
+    }
+
+    fromComplement();
+}
+
+// Elimina las palabras altas a cero. El cero siempre tiene signo 0
+void BigInt<2>::normalize() {
+    while (!limbs_.empty() && limbs_.back() == 0) {
+        limbs_.pop_back();
+    }
+    if (limbs_.empty()) {
+        sign_ = 0;
+    }
+}
+
+// Palabras que quedan por encima de las del complemento a dos
+uint64_t BigInt<2>::extension() const {
+    return sign_ == 1 ? ~uint64_t(0) : 0;
+}
+
+// Complemento a dos del número (~m + 1 si es negativo) en tantas palabras
+// como tiene la magnitud; por encima se asume extension()
+void BigInt<2>::complement(Limbs& words) const {
+    words = limbs_;
+    if (sign_ == 1) {
+        uint64_t carry = 1;
+        for (size_t i = 0; i < words.size(); i++) {
+            words[i] = ~words[i] + carry;
+            carry &= words[i] == 0;
+        }
+    }
+}
+
+// Operación inversa: limbs_ tiene el complemento a dos con la extensión de
+// sign_ y pasa a magnitud. La palabra extra recoge el caso -2^(64n)
+void BigInt<2>::fromComplement() {
+    if (sign_ == 1) {
+        limbs_.push_back(~uint64_t(0));
+        uint64_t carry = 1;
+        for (size_t i = 0; i < limbs_.size(); i++) {
+            limbs_[i] = ~limbs_[i] + carry;
+            carry &= limbs_[i] == 0;
+        }
+    }
+    normalize();
+}
+
+// Devuelve count (<= 64) bits de la magnitud a partir de position
+uint64_t BigInt<2>::bits(size_t position, size_t count) const {
+    size_t index = position / 64;
+    size_t offset = position % 64;
+    uint64_t value = index < limbs_.size() ? limbs_[index] >> offset : 0;
+    if (offset != 0 && index + 1 < limbs_.size()) {
+        value |= limbs_[index + 1] << (64 - offset);
+    }
+    return count < 64 ? value & ((uint64_t(1) << count) - 1) : value;
+}
+
+// Número de bits de la magnitud (0 para el cero)
+size_t BigInt<2>::bitLength() const {
+    return limbs_.empty() ? 0 : limbs_.size() * 64 - __builtin_clzll(limbs_.back());
+}
+
+// Asignment Operators
+BigInt<2>& BigInt<2>::operator=(const BigInt<2>& num) {
+    limbs_ = num.limbs_;
+    sign_ = num.sign_;
+
+    return *this;
+}
+
+BigInt<2>& BigInt<2>::operator=(BigInt<2>&& num) noexcept {
+    if (this != &num) {
+        limbs_.swap(num.limbs_);
+        sign_ = num.sign_;
+        num.limbs_.clear();
+        num.sign_ = 0;
+    }
+
+    return *this;
+}
+
+// Accesor Methods
+int BigInt<2>::sign() const {
+    return sign_;
+}
+
+// Bit index del complemento a dos
+char BigInt<2>::operator[](int index) const {
+    Limbs words;
+    complement(words);
+    size_t position = index / 64;
+    uint64_t word = position < words.size() ? words[position] : extension();
+    return (word >> (index % 64)) & 1;
+}
+
+// Cuerpo del complemento a dos, el bit menos significativo primero
+std::vector<bool> BigInt<2>::digits() const {
+    std::string str = toString();
+    std::vector<bool> digits(str.size() - 1);
+    for (size_t i = 0; i < digits.size(); i++) {
+        digits[i] = str[str.size() - 1 - i] == '1';
+    }
+    return digits;
+}
+
+void BigInt<2>::setSign(int sign) {
+    sign_ = sign;
+    normalize();
+}
+
+void BigInt<2>::setDigits(std::vector<bool> digits) {
+    std::string value(digits.size() + 1, '0');
+    value[0] = sign_ == 1 ? '1' : '0';
+    for (size_t i = 0; i < digits.size(); i++) {
+        if (digits[i]) {
+            value[digits.size() - i] = '1';
+        }
+    }
+    parse(value.c_str(), value.size());
+}
+
+// Cambia un bit del complemento a dos; el signo se conserva
+void BigInt<2>::setPosition(int position, bool value) {
+    Limbs words;
+    complement(words);
+    size_t index = position / 64;
+    if (index >= words.size()) {
+        words.resize(index + 1, extension());
+    }
+    if (value) {
+        words[index] |= uint64_t(1) << (position % 64);
+    } else {
+        words[index] &= ~(uint64_t(1) << (position % 64));
+    }
+    limbs_.swap(words);
+    fromComplement();
+}
+
+// El complemento a dos no se valida: cualquier cifra distinta de 0 es un 1
+const char* BigInt<2>::check(const std::string&) {
+    return nullptr;
+}
+
+// Las operaciones ya dejan el número sin palabras altas a cero, pero la
+// memoria reservada para el caso peor se conserva hasta aquí
+void BigInt<2>::shrink_to_fit() {
+    limbs_.shrink_to_fit();
+}
+
+// Comparison Operators
+
+// Devuelve -1, 0 o 1: primero el signo, luego la longitud de la magnitud y
+// por último sus palabras desde la más alta
+int BigInt<2>::compare(const BigInt<2>& num) const {
+    if (sign_ != num.sign_) {
+        return sign_ == 0 ? 1 : -1;
+    }
+
+    int cmp;
+    size_t size1 = limbs_.size();
+    size_t size2 = num.limbs_.size();
+    if (size1 != size2) {
+        cmp = size1 > size2 ? 1 : -1;
+    } else {
+        cmp = Kernels::instance().compare(limbs_.data(), num.limbs_.data(), size1);
+    }
+
+    return sign_ == 1 ? -cmp : cmp;
+}
+
+bool operator==(const BigInt<2>& num1, const BigInt<2>& num2) {
+    return num1.sign_ == num2.sign_ && num1.limbs_ == num2.limbs_;
+}
+
+bool BigInt<2>::operator!=(const BigInt<2>& num) const {
+    return !(*this == num);
+}
+
+bool operator>(const BigInt<2>& num1, const BigInt<2>& num2) {
+    return num1.compare(num2) > 0;
+}
+
+bool operator<(const BigInt<2>& num1, const BigInt<2>& num2) {
+    return num1.compare(num2) < 0;
+}
+
+bool BigInt<2>::operator>=(const BigInt<2>& num) const {
+    return compare(num) >= 0;
+}
+
+bool BigInt<2>::operator<=(const BigInt<2>& num) const {
+    return compare(num) <= 0;
+}
+
+// Increment and Decrement Operators
+BigInt<2>& BigInt<2>::operator++() {
+    return *this += BigInt<2>(1L);
+}
+
+BigInt<2> BigInt<2>::operator++(int) {
+    BigInt<2> aux = *this;
+    ++(*this);
+    return aux;
+}
+
+BigInt<2>& BigInt<2>::operator--() {
+    return *this -= BigInt<2>(1L);
+}
+
+BigInt<2> BigInt<2>::operator--(int) {
+    BigInt<2> aux = *this;
+    --(*this);
+    return aux;
+}
+
+// Arithmetic Operators
+
+// Suma (o resta) en signo y magnitud: con el mismo signo se suman las
+// magnitudes y con signos distintos se resta la menor de la mayor, que da el
+// signo. result puede ser uno de los operandos: cada palabra se lee antes de
+// escribirla y los tamaños se toman antes de agrandar su memoria
+void BigInt<2>::addWords(BigInt<2>& result, const BigInt<2>& num1, const BigInt<2>& num2, bool subtract) {
+
+    int64_t a, b, c;
+    if (num1.toWord(a) && num2.toWord(b) &&
+        !(subtract ? __builtin_sub_overflow(a, b, &c) : __builtin_add_overflow(a, b, &c))) {
+        result.assignWord(c);
+        return;
+    }
+
+    int sign1 = num1.sign_;
+    int sign2 = subtract ? 1 - num2.sign_ : num2.sign_;
+    size_t size1 = num1.limbs_.size();
+    size_t size2 = num2.limbs_.size();
+
+    // La parte común va al núcleo y el resto del operando largo solo propaga
+    // el acarreo o el préstamo
+    if (sign1 == sign2) {
+        const BigInt<2>& large = size1 >= size2 ? num1 : num2;
+        const BigInt<2>& small = size1 >= size2 ? num2 : num1;
+        size_t size = large.limbs_.size();
+        size_t smallSize = small.limbs_.size();
+
+        result.limbs_.resize(size + 1);
+
+        uint64_t carry = Kernels::instance().add(result.limbs_.data(), large.limbs_.data(), small.limbs_.data(), smallSize, 0);
+        for (size_t i = smallSize; i < size; i++) {
+            uint64_t sum = large.limbs_[i] + carry;
+            carry = sum < carry;
+            result.limbs_[i] = sum;
+        }
+        result.limbs_[size] = carry;
+        result.sign_ = sign1;
+    } else {
+        bool swap = compareWords(num1.limbs_.data(), size1, num2.limbs_.data(), size2) < 0;
+        const BigInt<2>& big = swap ? num2 : num1;
+        const BigInt<2>& small = swap ? num1 : num2;
+        size_t size = swap ? size2 : size1;
+        size_t smallSize = swap ? size1 : size2;
+
+        result.limbs_.resize(size);
+
+        uint64_t borrow = Kernels::instance().sub(result.limbs_.data(), big.limbs_.data(), small.limbs_.data(), smallSize, 0);
+        for (size_t i = smallSize; i < size; i++) {
+            uint64_t word = big.limbs_[i];
+            result.limbs_[i] = word - borrow;
+            borrow = word < borrow;
+        }
+        result.sign_ = swap ? sign2 : sign1;
+    }
+
+    result.normalize();
+}
+
+// Un número cabe en un int64_t si su magnitud no pasa de 2^63 - 1 (2^63 si
+// es negativo)
+bool BigInt<2>::toWord(int64_t& value) const {
+    if (limbs_.empty()) {
+        value = 0;
+        return true;
+    }
+    if (limbs_.size() == 1 && limbs_[0] <= uint64_t(INT64_MAX) + sign_) {
+        value = sign_ == 1 ? static_cast<int64_t>(0 - limbs_[0]) : static_cast<int64_t>(limbs_[0]);
+        return true;
+    }
+    return false;
+}
+
+// El cero no tiene palabras y el resto cabe en la memoria interna de Limbs
+void BigInt<2>::assignWord(int64_t value) {
+    limbs_.clear();
+    sign_ = value < 0 ? 1 : 0;
+    uint64_t magnitude = value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+    if (magnitude != 0) {
+        limbs_.push_back(magnitude);
+    }
+}
+
+// Cambia el signo sin tocar la magnitud
+void BigInt<2>::negate() {
+    if (!limbs_.empty()) {
+        sign_ = 1 - sign_;
+    }
+}
+
+BigInt<2> operator+(const BigInt<2>& num1, const BigInt<2>& num2) {
+    BigInt<2> result;
+    BigInt<2>::addWords(result, num1, num2, false);
+    return result;
+}
+
+BigInt<2> BigInt<2>::operator-(const BigInt<2> &num) const {
+    BigInt<2> result;
+    addWords(result, *this, num, true);
+    return result;
+}
+
+// La memoria crece con resize, que reserva de forma amortizada
+BigInt<2>& BigInt<2>::operator+=(const BigInt<2>& num) {
+    addWords(*this, *this, num, false);
+    return *this;
+}
+
+BigInt<2>& BigInt<2>::operator-=(const BigInt<2>& num) {
+    addWords(*this, *this, num, true);
+    return *this;
+}
+
+BigInt<2> operator+(BigInt<2>&& num1, const BigInt<2>& num2) {
+    num1 += num2;
+    return std::move(num1);
+}
+
+BigInt<2> operator+(const BigInt<2>& num1, BigInt<2>&& num2) {
+    num2 += num1;
+    return std::move(num2);
+}
+
+BigInt<2> operator+(BigInt<2>&& num1, BigInt<2>&& num2) {
+    num1 += num2;
+    return std::move(num1);
+}
+
+BigInt<2> operator-(BigInt<2>&& num1, const BigInt<2>& num2) {
+    num1 -= num2;
+    return std::move(num1);
+}
+
+BigInt<2> operator-(const BigInt<2>& num1, BigInt<2>&& num2) {
+    BigInt<2>::addWords(num2, num1, num2, true);
+    return std::move(num2);
+}
+
+BigInt<2> operator-(BigInt<2>&& num1, BigInt<2>&& num2) {
+    num1 -= num2;
+    return std::move(num1);
+}
+
+BigInt<2> operator-(BigInt<2>&& num) {
+    num.negate();
+    return std::move(num);
+}
+
+// Si el número es positivo devuelve su complemento a dos (el número negado)
+BigInt<2> BigInt<2>::complementTwo() const {
+
+    if (this->sign_ == 1) {
+        return *this;
+    }
+
+    return -*this;
+}
+
+BigInt<2> BigInt<2>::abs() const {
+    BigInt<2> result(*this);
+    result.sign_ = 0;
+    return result;
+}
+
+BigInt<2> BigInt<2>::operator-() const {
+    BigInt<2> result(*this);
+    result.negate();
+    return result;
+}
+
+// Shift and Bitwise Operators
+
+// Se desplaza la magnitud, igual para los dos signos. Las palabras se
+// recorren de arriba abajo para no pisar las que faltan por leer
+BigInt<2>& BigInt<2>::operator<<=(size_t shift) {
+
+    if (limbs_.empty()) {
+        return *this;
+    }
+
+    size_t wordShift = shift / 64;
+    int bitShift = shift % 64;
+    size_t size = limbs_.size();
+
+    if (wordShift > MaxShiftWords) {
+        std::cout << "Shift too large" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    limbs_.resize(size + wordShift + 1);
+
+    for (size_t i = size + 1; i-- > 0;) {
+        uint64_t word = i < size ? limbs_[i] << bitShift : 0;
+        if (bitShift != 0 && i > 0) {
+            word |= limbs_[i - 1] >> (64 - bitShift);
+        }
+        limbs_[i + wordShift] = word;
+    }
+    std::fill(limbs_.begin(), limbs_.begin() + wordShift, 0);
+
+    normalize();
+    return *this;
+}
+
+// Desplazamiento aritmético: redondea hacia menos infinito, así que si un
+// negativo pierde algún bit a uno su magnitud sube en uno. Las palabras se
+// recorren de abajo arriba
+BigInt<2>& BigInt<2>::operator>>=(size_t shift) {
+
+    size_t wordShift = shift / 64;
+    int bitShift = shift % 64;
+    size_t size = limbs_.size();
+
+    if (wordShift >= size) {
+        assignWord(sign_ == 1 ? -1 : 0);
+        return *this;
+    }
+
+    bool lost = false;
+    if (sign_ == 1) {
+        for (size_t i = 0; i < wordShift && !lost; i++) {
+            lost = limbs_[i] != 0;
+        }
+        lost = lost || (bitShift != 0 && (limbs_[wordShift] << (64 - bitShift)) != 0);
+    }
+
+    for (size_t i = 0; i < size - wordShift; i++) {
+        uint64_t word = limbs_[i + wordShift] >> bitShift;
+        if (bitShift != 0 && i + wordShift + 1 < size) {
+            word |= limbs_[i + wordShift + 1] << (64 - bitShift);
+        }
+        limbs_[i] = word;
+    }
+    limbs_.resize(size - wordShift);
+
+    if (lost) {
+        limbs_.push_back(0);
+        for (size_t i = 0; ++limbs_[i] == 0; i++) {
+        }
+    }
+
+    normalize();
+    return *this;
+}
+
+// La copia ya reserva el tamaño final, si no supera el límite que comprueba <<=
+BigInt<2> BigInt<2>::operator<<(size_t shift) const {
+    BigInt<2> result;
+    if (!limbs_.empty() && shift / 64 <= MaxShiftWords) {
+        result.limbs_.reserve(limbs_.size() + shift / 64 + 1);
+    }
+    result = *this;
+    result <<= shift;
+    return result;
+}
+
+BigInt<2> BigInt<2>::operator>>(size_t shift) const {
+    BigInt<2> result(*this);
+    result >>= shift;
+    return result;
+}
+
+// Si *this << shift se puede calcular sin salir con "Shift too large". Una
+// cantidad de más de una palabra no cabe ni para el cero
+bool BigInt<2>::leftShiftFits(const BigInt<2>& shift) const {
+    if (shift.sign_ == 1) {
+        return true;
+    }
+    if (shift.limbs_.size() > 1) {
+        return false;
+    }
+    return limbs_.empty() || shift.bits(0, 64) / 64 <= MaxShiftWords;
+}
+
+// Desplazamientos con la cantidad como BigInt<2>: negativa invierte el sentido
+BigInt<2>& BigInt<2>::operator<<=(const BigInt<2>& shift) {
+
+    if (shift.sign_ == 1) {
+        return *this >>= -shift;
+    }
+
+    if (shift.limbs_.size() > 1) {
+        std::cout << "Shift too large" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    return *this <<= (size_t)shift.bits(0, 64);
+}
+
+BigInt<2>& BigInt<2>::operator>>=(const BigInt<2>& shift) {
+
+    if (shift.sign_ == 1) {
+        return *this <<= -shift;
+    }
+
+    // Cualquier cantidad de más de una palabra deja 0 o -1 según el signo
+    if (shift.limbs_.size() > 1) {
+        assignWord(sign_ == 1 ? -1 : 0);
+        return *this;
+    }
+
+    return *this >>= (size_t)shift.bits(0, 64);
+}
+
+BigInt<2> BigInt<2>::operator<<(const BigInt<2>& shift) const {
+
+    if (shift.sign_ == 1) {
+        return *this >> -shift;
+    }
+
+    if (shift.limbs_.size() > 1) {
+        std::cout << "Shift too large" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    return *this << (size_t)shift.bits(0, 64);
+}
+
+BigInt<2> BigInt<2>::operator>>(const BigInt<2>& shift) const {
+
+    if (shift.sign_ == 1) {
+        return *this << -shift;
+    }
+
+    // Cualquier cantidad de más de una palabra deja 0 o -1 según el signo
+    if (shift.limbs_.size() > 1) {
+        return BigInt<2>(sign_ == 1 ? -1L : 0L);
+    }
+
+    return *this >> (size_t)shift.bits(0, 64);
+}
+
+// Operación bit a bit sobre el complemento a dos de los operandos, que se
+// calcula al vuelo: ~m + 1, con el acarreo pasando mientras las palabras de
+// la magnitud son cero. El resultado vuelve a magnitud al final
+BigInt<2> BigInt<2>::bitwiseWords(const BigInt<2>& a, const BigInt<2>& b, char op) {
+
+    size_t size = std::max(a.limbs_.size(), b.limbs_.size());
+    uint64_t carryA = a.sign_, carryB = b.sign_;
+
+    BigInt<2> result;
+    result.limbs_.resize(size);
+
+    for (size_t i = 0; i < size; i++) {
+        uint64_t x = i < a.limbs_.size() ? a.limbs_[i] : 0;
+        uint64_t y = i < b.limbs_.size() ? b.limbs_[i] : 0;
+        if (a.sign_ == 1) {
+            x = ~x + carryA;
+            carryA &= x == 0;
+        }
+        if (b.sign_ == 1) {
+            y = ~y + carryB;
+            carryB &= y == 0;
+        }
+        result.limbs_[i] = op == '&' ? x & y : op == '|' ? x | y : x ^ y;
+    }
+    result.sign_ = op == '&' ? a.sign_ & b.sign_ : op == '|' ? a.sign_ | b.sign_ : a.sign_ ^ b.sign_;
+
+    result.fromComplement();
+    return result;
+}
+
+BigInt<2> BigInt<2>::operator&(const BigInt<2>& num) const {
+    return bitwiseWords(*this, num, '&');
+}
+
+BigInt<2> BigInt<2>::operator|(const BigInt<2>& num) const {
+    return bitwiseWords(*this, num, '|');
+}
+
+BigInt<2> BigInt<2>::operator^(const BigInt<2>& num) const {
+    return bitwiseWords(*this, num, '^');
+}
+
+// ~x = -x - 1
+BigInt<2> BigInt<2>::operator~() const {
+    BigInt<2> result;
+    addWords(result, BigInt<2>(-1L), *this, true);
+    return result;
+}
+
+// Operaciones sobre magnitudes: vectores de palabras sin signo, la menos
+// significativa primero
+
+// r += a, propagando el acarreo por las rn palabras de r (rn >= an).
+// Devuelve el acarreo que sale de r
+uint64_t BigInt<2>::addTo(uint64_t* r, size_t rn, const uint64_t* a, size_t an) {
+    uint64_t carry = Kernels::instance().add(r, r, a, an, 0);
+    for (size_t i = an; carry != 0 && i < rn; i++) {
+        carry = ++r[i] == 0;
+    }
+    return carry;
+}
+
+// r -= a, propagando el préstamo por las rn palabras de r (rn >= an).
+// Devuelve el préstamo que sale de r
+uint64_t BigInt<2>::subFrom(uint64_t* r, size_t rn, const uint64_t* a, size_t an) {
+    uint64_t borrow = Kernels::instance().sub(r, r, a, an, 0);
+    for (size_t i = an; borrow != 0 && i < rn; i++) {
+        borrow = r[i]-- == 0;
+    }
+    return borrow;
+}
+
+// r[0 .. an + bn) = a * b. Elige el algoritmo según el tamaño del menor.
+// Si a y b son el mismo operando (a == b, an == bn) cada algoritmo calcula
+// un cuadrado, evaluando o transformando el operando una sola vez
+void BigInt<2>::mulWords(uint64_t* r, const uint64_t* a, size_t an, const uint64_t* b, size_t bn) {
+
+    if (an < bn) {
+        std::swap(a, b);
+        std::swap(an, bn);
+    }
+
+    if (bn < BIGINT_KARATSUBA_THRESHOLD) {
+        if (a == b && an == bn) {
+            sqrBasecase(r, a, an);
+        } else {
+            mulBasecase(r, a, an, b, bn);
+        }
+    } else if (bn >= BIGINT_NTT_THRESHOLD) {
+        mulNTT(r, a, an, b, bn);
+    } else if (an >= 2 * bn) {
+        mulUnbalanced(r, a, an, b, bn);
+    } else if (bn >= BIGINT_TOOM4_THRESHOLD && bn > 3 * ((an + 3) / 4)) {
+        mulToom4(r, a, an, b, bn);
+    } else if (bn >= BIGINT_TOOM3_THRESHOLD && bn > 2 * ((an + 2) / 3)) {
+        mulToom3(r, a, an, b, bn);
+    } else {
+        mulKaratsuba(r, a, an, b, bn);
+    }
+}
+
+// a mucho más largo que b: se multiplica b por trozos de bn palabras de a,
+// sin rellenar b hasta el tamaño de a
+void BigInt<2>::mulUnbalanced(uint64_t* r, const uint64_t* a, size_t an, const uint64_t* b, size_t bn) {
+
+    // En paralelo cada trozo tiene su propio producto y se suman después
+    if (bn >= BIGINT_PARALLEL_THRESHOLD && TaskPool::parallel()) {
+        size_t chunks = (an + bn - 1) / bn;
+        std::vector<uint64_t> temp((chunks - 1) * 2 * bn);
+        TaskPool::Group group;
+        for (size_t c = 1; c < chunks; c++) {
+            group.run([=, &temp]() {
+                mulWords(temp.data() + (c - 1) * 2 * bn, a + c * bn, std::min(bn, an - c * bn), b, bn);
+            });
+        }
+        mulWords(r, a, bn, b, bn);
+        std::fill(r + 2 * bn, r + an + bn, 0);
+        group.wait();
+        for (size_t c = 1; c < chunks; c++) {
+            addTo(r + c * bn, an + bn - c * bn, temp.data() + (c - 1) * 2 * bn, std::min(bn, an - c * bn) + bn);
+        }
+        return;
+    }
+
+    std::vector<uint64_t> temp(2 * bn);
+
+    mulWords(r, a, bn, b, bn);
+    std::fill(r + 2 * bn, r + an + bn, 0);
+
+    for (size_t i = bn; i < an; i += bn) {
+        size_t size = std::min(bn, an - i);
+        mulWords(temp.data(), a + i, size, b, bn);
+        addTo(r + i, an + bn - i, temp.data(), size + bn);
+    }
+}
+
+// Producto palabra a palabra
+void BigInt<2>::mulBasecase(uint64_t* r, const uint64_t* a, size_t an, const uint64_t* b, size_t bn) {
+
+    std::fill(r, r + an + bn, 0);
+
+    const Kernels& kernels = Kernels::instance();
+    for (size_t i = 0; i < an; i++) {
+        r[i + bn] = kernels.addmul(r + i, b, bn, a[i]);
+    }
+}
+
+// Cuadrado palabra a palabra: los productos cruzados a[i]·a[j] (i < j) se
+// calculan una vez y se duplican, y después se suman los a[i]^2
+void BigInt<2>::sqrBasecase(uint64_t* r, const uint64_t* a, size_t an) {
+
+    std::fill(r, r + 2 * an, 0);
+
+    const Kernels& kernels = Kernels::instance();
+    for (size_t i = 0; i < an; i++) {
+        r[i + an] = kernels.addmul(r + 2 * i + 1, a + i + 1, an - i - 1, a[i]);
+    }
+
+    uint64_t high = 0;
+    for (size_t i = 0; i < 2 * an; i++) {
+        uint64_t word = r[i];
+        r[i] = (word << 1) | high;
+        high = word >> 63;
+    }
+
+    uint64_t carry = 0;
+    for (size_t i = 0; i < an; i++) {
+        unsigned __int128 square = (unsigned __int128)a[i] * a[i];
+        unsigned __int128 sum = (unsigned __int128)r[2 * i] + (uint64_t)square + carry;
+        r[2 * i] = (uint64_t)sum;
+        sum = (sum >> 64) + r[2 * i + 1] + (uint64_t)(square >> 64);
+        r[2 * i + 1] = (uint64_t)sum;
+        carry = (uint64_t)(sum >> 64);
+    }
+}
+
+// |a - b| en r (max(an, bn) palabras). Devuelve true si a < b
+bool BigInt<2>::absDiff(uint64_t* r, const uint64_t* a, size_t an, const uint64_t* b, size_t bn) {
+    bool negative = compareWords(a, an, b, bn) < 0;
+    if (negative) {
+        std::swap(a, b);
+        std::swap(an, bn);
+    }
+    std::copy(a, a + an, r);
+    subFrom(r, an, b, bn);
+    return negative;
+}
+
+// Compara dos magnitudes que pueden tener palabras altas a cero
+int BigInt<2>::compareWords(const uint64_t* a, size_t an, const uint64_t* b, size_t bn) {
+    while (an > 0 && a[an - 1] == 0) {
+        an--;
+    }
+    while (bn > 0 && b[bn - 1] == 0) {
+        bn--;
+    }
+    if (an != bn) {
+        return an > bn ? 1 : -1;
+    }
+    return Kernels::instance().compare(a, b, an);
+}
+
+// Karatsuba con an >= bn. Con a = a1·B^m + a0 y b = b1·B^m + b0:
+//     a·b = a1·b1·B^2m + (a0·b0 + a1·b1 - (a0 - a1)(b0 - b1))·B^m + a0·b0
+void BigInt<2>::mulKaratsuba(uint64_t* r, const uint64_t* a, size_t an, const uint64_t* b, size_t bn) {
+
+    size_t m = (an + 1) / 2;
+    size_t size = an + bn;
+
+    // Si b no llega a la mitad de a solo se parte a: a·b = a1·b·B^m + a0·b
+    bool parallel = bn >= BIGINT_PARALLEL_THRESHOLD && TaskPool::parallel();
+    TaskPool::Group group;
+
+    if (bn <= m) {
+        std::vector<uint64_t> high(an - m + bn);
+        if (parallel) {
+            group.run([&]() { mulWords(high.data(), a + m, an - m, b, bn); });
+            mulWords(r, a, m, b, bn);
+            group.wait();
+        } else {
+            mulWords(r, a, m, b, bn);
+            mulWords(high.data(), a + m, an - m, b, bn);
+        }
+        std::fill(r + m + bn, r + size, 0);
+        addTo(r + m, size - m, high.data(), high.size());
+        return;
+    }
+
+    std::vector<uint64_t> temp(6 * m + 1);
+    uint64_t* diffA = temp.data();
+    uint64_t* diffB = diffA + m;
+    uint64_t* product = diffB + m;
+    uint64_t* middle = product + 2 * m;
+
+    // Al elevar al cuadrado las dos diferencias coinciden y el término
+    // central es a0^2 + a1^2 - (a0 - a1)^2
+    bool squaring = a == b && an == bn;
+    bool negative = false;
+    if (squaring) {
+        absDiff(diffA, a, m, a + m, an - m);
+        diffB = diffA;
+    } else {
+        negative = absDiff(diffA, a, m, a + m, an - m) != absDiff(diffB, b, m, b + m, bn - m);
+    }
+
+    // Los tres productos escriben en zonas distintas
+    if (parallel) {
+        group.run([&]() { mulWords(r + 2 * m, a + m, an - m, b + m, bn - m); });
+        group.run([&]() { mulWords(product, diffA, m, diffB, m); });
+        mulWords(r, a, m, b, m);
+        group.wait();
+    } else {
+        mulWords(r, a, m, b, m);
+        mulWords(r + 2 * m, a + m, an - m, b + m, bn - m);
+        mulWords(product, diffA, m, diffB, m);
+    }
+
+    // middle = a0·b0 + a1·b1 -/+ |a0 - a1|·|b0 - b1|
+    std::copy(r, r + 2 * m, middle);
+    middle[2 * m] = addTo(middle, 2 * m, r + 2 * m, size - 2 * m);
+    if (negative) {
+        addTo(middle, 2 * m + 1, product, 2 * m);
+    } else {
+        subFrom(middle, 2 * m + 1, product, 2 * m);
+    }
+
+    size_t middleSize = 2 * m + 1;
+    while (middleSize > 0 && middle[middleSize - 1] == 0) {
+        middleSize--;
+    }
+    addTo(r + m, size - m, middle, middleSize);
+}
+
+// Operaciones con signo para Toom-Cook
+
+BigInt<2>::Signed BigInt<2>::toSigned(const uint64_t* a, size_t an) {
+    Signed result;
+    while (an > 0 && a[an - 1] == 0) {
+        an--;
+    }
+    result.words.assign(a, a + an);
+    return result;
+}
+
+// r = r + a (o r - a si subtract)
+void BigInt<2>::addSigned(Signed& r, const Signed& a, bool subtract) {
+
+    bool negative = a.negative != subtract;
+
+    if (r.negative == negative) {
+        r.words.resize(std::max(r.words.size(), a.words.size()) + 1, 0);
+        addTo(r.words.data(), r.words.size(), a.words.data(), a.words.size());
+    } else if (compareWords(r.words.data(), r.words.size(), a.words.data(), a.words.size()) >= 0) {
+        subFrom(r.words.data(), r.words.size(), a.words.data(), a.words.size());
+    } else {
+        std::vector<uint64_t> diff = a.words;
+        subFrom(diff.data(), diff.size(), r.words.data(), r.words.size());
+        r.words.swap(diff);
+        r.negative = negative;
+    }
+
+    while (!r.words.empty() && r.words.back() == 0) {
+        r.words.pop_back();
+    }
+    if (r.words.empty()) {
+        r.negative = false;
+    }
+}
+
+BigInt<2>::Signed BigInt<2>::mulSigned(const Signed& a, const Signed& b) {
+    Signed result;
+    result.words.resize(a.words.size() + b.words.size());
+    mulWords(result.words.data(), a.words.data(), a.words.size(), b.words.data(), b.words.size());
+    while (!result.words.empty() && result.words.back() == 0) {
+        result.words.pop_back();
+    }
+    result.negative = !result.words.empty() && a.negative != b.negative;
+    return result;
+}
+
+// w[i] = left[i] · right[i]. Con parallel cada producto es una tarea
+void BigInt<2>::mulPoints(Signed* w, const Signed* const* left, const Signed* const* right, size_t count, bool parallel) {
+
+    if (!parallel || !TaskPool::parallel()) {
+        for (size_t i = 0; i < count; i++) {
+            w[i] = mulSigned(*left[i], *right[i]);
+        }
+        return;
+    }
+
+    TaskPool::Group group;
+    for (size_t i = 1; i < count; i++) {
+        group.run([=]() { w[i] = mulSigned(*left[i], *right[i]); });
+    }
+    w[0] = mulSigned(*left[0], *right[0]);
+    group.wait();
+}
+
+// r · 2^shift si shift > 0, r / 2^-shift (exacta) si shift < 0. |shift| < 64
+void BigInt<2>::shiftSigned(Signed& r, int shift) {
+
+    std::vector<uint64_t>& words = r.words;
+
+    if (shift > 0) {
+        words.push_back(0);
+        for (size_t i = words.size() - 1; i > 0; i--) {
+            words[i] = (words[i] << shift) | (words[i - 1] >> (64 - shift));
+        }
+        words[0] <<= shift;
+    } else if (shift < 0) {
+        shift = -shift;
+        for (size_t i = 0; i + 1 < words.size(); i++) {
+            words[i] = (words[i] >> shift) | (words[i + 1] << (64 - shift));
+        }
+        if (!words.empty()) {
+            words.back() >>= shift;
+        }
+    }
+
+    while (!words.empty() && words.back() == 0) {
+        words.pop_back();
+    }
+    if (words.empty()) {
+        r.negative = false;
+    }
+}
+
+// División exacta entre un divisor impar: se multiplica cada palabra por el
+// inverso del divisor módulo 2^64 y se arrastra la parte alta como préstamo
+void BigInt<2>::divExactSigned(Signed& r, uint64_t divisor) {
+
+    uint64_t inverse = divisor;
+    for (int i = 0; i < 5; i++) {
+        inverse *= 2 - divisor * inverse;
+    }
+
+    uint64_t borrow = 0;
+    for (size_t i = 0; i < r.words.size(); i++) {
+        uint64_t word = r.words[i];
+        uint64_t underflow = word < borrow;
+        uint64_t quotient = (word - borrow) * inverse;
+        r.words[i] = quotient;
+        borrow = (uint64_t)(((unsigned __int128)quotient * divisor) >> 64) + underflow;
+    }
+
+    while (!r.words.empty() && r.words.back() == 0) {
+        r.words.pop_back();
+    }
+    if (r.words.empty()) {
+        r.negative = false;
+    }
+}
+
+// r = sum(coefficients[i] · B^(i·k)). Los coeficientes ya son no negativos
+void BigInt<2>::addCoefficients(uint64_t* r, size_t rn, const Signed* coefficients, size_t count, size_t k) {
+    std::fill(r, r + rn, 0);
+    for (size_t i = 0; i < count; i++) {
+        const std::vector<uint64_t>& words = coefficients[i].words;
+        addTo(r + i * k, rn - i * k, words.data(), words.size());
+    }
+}
+
+// Toom-3: a y b en tres trozos de k palabras, evaluados en 0, 1, -1, -2 e
+// infinito, e interpolación con la secuencia de Bodrato
+void BigInt<2>::mulToom3(uint64_t* r, const uint64_t* a, size_t an, const uint64_t* b, size_t bn) {
+
+    size_t k = (an + 2) / 3;
+
+    Signed a0 = toSigned(a, k), a1 = toSigned(a + k, k), a2 = toSigned(a + 2 * k, an - 2 * k);
+    Signed b0, b1, b2;
+    if (a != b || an != bn) {
+        b0 = toSigned(b, k);
+        b1 = toSigned(b + k, k);
+        b2 = toSigned(b + 2 * k, bn - 2 * k);
+    }
+
+    // Evaluación: x(-2) = 2·(x(-1) + x2) - x0
+    Signed evenA = a0;
+    addSigned(evenA, a2);
+    Signed a1p = evenA, am1 = evenA;
+    addSigned(a1p, a1);
+    addSigned(am1, a1, true);
+    Signed am2 = am1;
+    addSigned(am2, a2);
+    shiftSigned(am2, 1);
+    addSigned(am2, a0, true);
+
+    Signed evenB = b0;
+    addSigned(evenB, b2);
+    Signed b1p = evenB, bm1 = evenB;
+    addSigned(b1p, b1);
+    addSigned(bm1, b1, true);
+    Signed bm2 = bm1;
+    addSigned(bm2, b2);
+    shiftSigned(bm2, 1);
+    addSigned(bm2, b0, true);
+
+    // Al elevar al cuadrado se usan los mismos puntos en los dos factores
+    bool squaring = a == b && an == bn;
+
+    const Signed* left[5] = {&a0, &a1p, &am1, &am2, &a2};
+    const Signed* right[5] = {&b0, &b1p, &bm1, &bm2, &b2};
+    Signed w[5];
+    mulPoints(w, left, squaring ? left : right, 5, bn >= BIGINT_PARALLEL_THRESHOLD);
+
+    Signed c[5];
+    c[0] = w[0];
+    Signed& w1 = w[1];
+    Signed& wm1 = w[2];
+    Signed& wm2 = w[3];
+    c[4] = w[4];
+
+    // Interpolación
+    c[3] = wm2;
+    addSigned(c[3], w1, true);
+    divExactSigned(c[3], 3);            // (w(-2) - w(1)) / 3
+    c[1] = w1;
+    addSigned(c[1], wm1, true);
+    shiftSigned(c[1], -1);              // (w(1) - w(-1)) / 2
+    c[2] = wm1;
+    addSigned(c[2], c[0], true);        // w(-1) - w(0)
+    Signed temp = c[2];
+    addSigned(temp, c[3], true);
+    shiftSigned(temp, -1);
+    c[3] = temp;
+    temp = c[4];
+    shiftSigned(temp, 1);
+    addSigned(c[3], temp);              // (c2 - c3) / 2 + 2·w(inf)
+    addSigned(c[2], c[1]);
+    addSigned(c[2], c[4], true);        // c2 + c1 - w(inf)
+    addSigned(c[1], c[3], true);        // c1 - c3
+
+    addCoefficients(r, an + bn, c, 5, k);
+}
+
+// Toom-4: a y b en cuatro trozos de k palabras, evaluados en 0, 1, -1, 2, -2,
+// 1/2 e infinito
+void BigInt<2>::mulToom4(uint64_t* r, const uint64_t* a, size_t an, const uint64_t* b, size_t bn) {
+
+    size_t k = (an + 3) / 4;
+
+    const uint64_t* factors[2] = {a, b};
+    size_t sizes[2] = {an, bn};
+    Signed points[2][7];
+
+    // Al elevar al cuadrado solo se evalúa el primer factor
+    bool squaring = a == b && an == bn;
+
+    // points[i] = x(0), x(1), x(-1), x(2), x(-2), 8·x(1/2), x(inf)
+    for (int i = 0; i < (squaring ? 1 : 2); i++) {
+        const uint64_t* x = factors[i];
+        Signed x0 = toSigned(x, k), x1 = toSigned(x + k, k), x2 = toSigned(x + 2 * k, k);
+        Signed x3 = toSigned(x + 3 * k, sizes[i] - 3 * k);
+
+        Signed even = x0, odd = x1;
+        addSigned(even, x2);
+        addSigned(odd, x3);
+        points[i][1] = even;
+        addSigned(points[i][1], odd);
+        points[i][2] = even;
+        addSigned(points[i][2], odd, true);
+
+        // x0 + 4·x2 y 2·(x1 + 4·x3)
+        even = x2;
+        shiftSigned(even, 2);
+        addSigned(even, x0);
+        odd = x3;
+        shiftSigned(odd, 2);
+        addSigned(odd, x1);
+        shiftSigned(odd, 1);
+        points[i][3] = even;
+        addSigned(points[i][3], odd);
+        points[i][4] = even;
+        addSigned(points[i][4], odd, true);
+
+        // ((2·x0 + x1)·2 + x2)·2 + x3
+        Signed half = x0;
+        shiftSigned(half, 1);
+        addSigned(half, x1);
+        shiftSigned(half, 1);
+        addSigned(half, x2);
+        shiftSigned(half, 1);
+        addSigned(half, x3);
+        points[i][5] = half;
+
+        points[i][0] = x0;
+        points[i][6] = x3;
+    }
+
+    const Signed* left[7];
+    const Signed* right[7];
+    for (int i = 0; i < 7; i++) {
+        left[i] = &points[0][i];
+        right[i] = &points[squaring ? 0 : 1][i];
+    }
+    Signed w[7];
+    mulPoints(w, left, right, 7, bn >= BIGINT_PARALLEL_THRESHOLD);
+
+    Signed c[7];
+    c[0] = w[0];
+    c[6] = w[6];
+
+    // Partes par e impar de los puntos +-1 y +-2
+    Signed even1 = w[1], odd1 = w[1], even2 = w[3], odd2 = w[3];
+    addSigned(even1, w[2]);
+    shiftSigned(even1, -1);             // c0 + c2 + c4 + c6
+    addSigned(odd1, w[2], true);
+    shiftSigned(odd1, -1);              // c1 + c3 + c5
+    addSigned(even2, w[4]);
+    shiftSigned(even2, -1);             // c0 + 4·c2 + 16·c4 + 64·c6
+    addSigned(odd2, w[4], true);
+    shiftSigned(odd2, -2);              // c1 + 4·c3 + 16·c5
+
+    // Coeficientes pares
+    Signed temp = c[6];
+    shiftSigned(temp, 6);
+    addSigned(even1, c[0], true);
+    addSigned(even1, c[6], true);       // c2 + c4
+    addSigned(even2, c[0], true);
+    addSigned(even2, temp, true);
+    shiftSigned(even2, -2);             // c2 + 4·c4
+    c[4] = even2;
+    addSigned(c[4], even1, true);
+    divExactSigned(c[4], 3);
+    c[2] = even1;
+    addSigned(c[2], c[4], true);
+
+    // 16·c1 + 4·c3 + c5 a partir del punto 1/2
+    Signed high = w[5];
+    temp = c[0];
+    shiftSigned(temp, 6);
+    addSigned(high, temp, true);
+    addSigned(high, c[6], true);
+    temp = c[2];
+    shiftSigned(temp, 4);
+    addSigned(high, temp, true);
+    temp = c[4];
+    shiftSigned(temp, 2);
+    addSigned(high, temp, true);
+    shiftSigned(high, -1);
+
+    // Coeficientes impares
+    Signed p = high;                    // 5·c1 + c3
+    addSigned(p, odd1, true);
+    divExactSigned(p, 3);
+    Signed q = odd2;                    // c3 + 5·c5
+    addSigned(q, odd1, true);
+    divExactSigned(q, 3);
+    Signed d = p;                       // c1 - c5
+    addSigned(d, q, true);
+    divExactSigned(d, 5);
+    Signed sum = p;                     // c1 + c5
+    addSigned(sum, q);
+    temp = odd1;
+    shiftSigned(temp, 1);
+    addSigned(sum, temp, true);
+    divExactSigned(sum, 3);
+
+    c[1] = sum;
+    addSigned(c[1], d);
+    shiftSigned(c[1], -1);
+    c[5] = sum;
+    addSigned(c[5], d, true);
+    shiftSigned(c[5], -1);
+    c[3] = odd1;
+    addSigned(c[3], sum, true);
+
+    addCoefficients(r, an + bn, c, 7, k);
+}
+
+// Multiplicación por NTT
+
+// Producto de Montgomery: a·b·2^-64 mod p, con inverse = -p^-1 mod 2^64
+uint64_t BigInt<2>::montMul(uint64_t a, uint64_t b, uint64_t modulus, uint64_t inverse) {
+    unsigned __int128 product = (unsigned __int128)a * b;
+    uint64_t m = (uint64_t)product * inverse;
+    uint64_t result = (uint64_t)((product + (unsigned __int128)m * modulus) >> 64);
+    return result >= modulus ? result - modulus : result;
+}
+
+uint64_t BigInt<2>::powMod(uint64_t base, uint64_t exponent, uint64_t modulus) {
+    uint64_t result = 1;
+    base %= modulus;
+    while (exponent > 0) {
+        if (exponent & 1) {
+            result = (uint64_t)((unsigned __int128)result * base % modulus);
+        }
+        base = (uint64_t)((unsigned __int128)base * base % modulus);
+        exponent >>= 1;
+    }
+    return result;
+}
+
+// Una etapa de mariposas sobre data[j] y data[j + half] para from <= j < to,
+// con la raíz roots[j·stride]. La directa (Gentleman-Sande) resta antes de
+// multiplicar por la raíz y la inversa (Cooley-Tukey) multiplica antes
+void BigInt<2>::butterflies(uint64_t* data, size_t half, size_t from, size_t to, const uint64_t* roots, size_t stride, uint64_t modulus, uint64_t inverse, bool backward) {
+
+    for (size_t j = from; j < to; j++) {
+        uint64_t& x = data[j];
+        uint64_t& y = data[j + half];
+        uint64_t root = roots[j * stride];
+
+        if (backward) {
+            uint64_t u = x;
+            uint64_t v = montMul(y, root, modulus, inverse);
+            x = u + v >= modulus ? u + v - modulus : u + v;
+            y = u >= v ? u - v : u + modulus - v;
+        } else {
+            uint64_t u = x;
+            uint64_t v = y;
+            x = u + v >= modulus ? u + v - modulus : u + v;
+            y = montMul(u >= v ? u - v : u + modulus - v, root, modulus, inverse);
+        }
+    }
+}
+
+// NTT de tamaño n (potencia de dos) sobre valores menores que el módulo.
+// roots[j·stride] es w^j en forma de Montgomery, j < n / 2, con w la raíz
+// n-ésima. La directa deja el resultado en orden de bits invertido y la
+// inversa lo recibe en ese orden, así que no hace falta reordenar.
+// Por encima del umbral las dos mitades son transformadas independientes y
+// se reparten entre hilos, igual que las mariposas de la etapa que las une
+void BigInt<2>::transform(uint64_t* data, size_t n, const uint64_t* roots, size_t stride, uint64_t modulus, uint64_t inverse, bool backward) {
+
+    if (n < BIGINT_NTT_PARALLEL_THRESHOLD || !TaskPool::parallel()) {
+        for (size_t half = backward ? 1 : n / 2; half >= 1 && half < n; half = backward ? half * 2 : half / 2) {
+            for (size_t start = 0; start < n; start += 2 * half) {
+                butterflies(data + start, half, 0, half, roots, stride * (n / (2 * half)), modulus, inverse, backward);
+            }
+        }
+        return;
+    }
+
+    size_t half = n / 2;
+    size_t chunk = BIGINT_NTT_PARALLEL_THRESHOLD / 2;
+    TaskPool::Group group;
+
+    auto stage = [&]() {
+        for (size_t from = chunk; from < half; from += chunk) {
+            group.run([=]() { butterflies(data, half, from, std::min(from + chunk, half), roots, stride, modulus, inverse, backward); });
+        }
+        butterflies(data, half, 0, std::min(chunk, half), roots, stride, modulus, inverse, backward);
+        group.wait();
+    };
+
+    if (!backward) {
+        stage();
+    }
+    group.run([=]() { transform(data + half, half, roots, 2 * stride, modulus, inverse, backward); });
+    transform(data, half, roots, 2 * stride, modulus, inverse, backward);
+    group.wait();
+    if (backward) {
+        stage();
+    }
+}
+
+// Residuos del producto módulo un primo: transforma los operandos, multiplica
+// punto a punto y deshace la transformada. modulus = primes[0], con generador
+// primes[1]. Deja en inverse y square los datos de Montgomery del primo
+void BigInt<2>::convolution(std::vector<uint64_t>& data, size_t n, const uint64_t* a, size_t an, const uint64_t* b, size_t bn, const uint64_t* prime, uint64_t& inverse, uint64_t& square) {
+
+    uint64_t modulus = prime[0];
+    bool squaring = a == b && an == bn;
+
+    inverse = modulus;
+    for (int i = 0; i < 5; i++) {
+        inverse *= 2 - modulus * inverse;
+    }
+    inverse = -inverse;
+
+    // 2^128 mod p, para pasar a forma de Montgomery con montMul(x, square)
+    uint64_t power = (uint64_t)(((unsigned __int128)1 << 64) % modulus);
+    square = (uint64_t)((unsigned __int128)power * power % modulus);
+
+    data.assign(n, 0);
+    for (size_t i = 0; i < an; i++) {
+        data[i] = a[i] % modulus;
+    }
+
+    // Potencias de una raíz n-ésima primitiva de la unidad
+    std::vector<uint64_t> roots(n / 2);
+    uint64_t root = powMod(prime[1], (modulus - 1) / n, modulus);
+    uint64_t step = montMul(root, square, modulus, inverse);
+    roots[0] = power;
+    for (size_t j = 1; j < n / 2; j++) {
+        roots[j] = montMul(roots[j - 1], step, modulus, inverse);
+    }
+
+    // Al elevar al cuadrado basta con transformar un operando
+    transform(data.data(), n, roots.data(), 1, modulus, inverse, false);
+    if (squaring) {
+        for (size_t i = 0; i < n; i++) {
+            data[i] = montMul(data[i], data[i], modulus, inverse);
+        }
+    } else {
+        std::vector<uint64_t> other(n, 0);
+        for (size_t i = 0; i < bn; i++) {
+            other[i] = b[i] % modulus;
+        }
+        transform(other.data(), n, roots.data(), 1, modulus, inverse, false);
+        // El producto punto a punto introduce un factor 2^-64
+        for (size_t i = 0; i < n; i++) {
+            data[i] = montMul(data[i], other[i], modulus, inverse);
+        }
+    }
+
+    uint64_t rootInverse = montMul(powMod(root, modulus - 2, modulus), square, modulus, inverse);
+    roots[0] = power;
+    for (size_t j = 1; j < n / 2; j++) {
+        roots[j] = montMul(roots[j - 1], rootInverse, modulus, inverse);
+    }
+
+    transform(data.data(), n, roots.data(), 1, modulus, inverse, true);
+
+    // Deshacer el factor n de la inversa y el 2^-64 del producto
+    uint64_t scale = (uint64_t)((unsigned __int128)power * powMod(n, modulus - 2, modulus) % modulus);
+    scale = montMul(scale, square, modulus, inverse);
+    for (size_t i = 0; i < n; i++) {
+        data[i] = montMul(data[i], scale, modulus, inverse);
+    }
+}
+
+// Convolución de las palabras módulo tres primos p = c·2^50 + 1 de 61 bits.
+// Cada coeficiente es menor que n·2^128 < p1·p2·p3, así que se reconstruye
+// exactamente con el teorema chino del resto (Garner). Los tres primos son
+// independientes y con varios hilos cada uno es una tarea
+void BigInt<2>::mulNTT(uint64_t* r, const uint64_t* a, size_t an, const uint64_t* b, size_t bn) {
+
+    static const uint64_t primes[3][2] = {
+        {2287828610704211969ULL, 3},
+        {2276569611635785729ULL, 11},
+        {2254051613498933249ULL, 3}
+    };
+
+    size_t n = 1;
+    while (n < an + bn - 1) {
+        n <<= 1;
+    }
+
+    std::vector<uint64_t> residues[3];
+    uint64_t inverses[3];
+    uint64_t squares[3];
+    bool parallel = n >= BIGINT_NTT_PARALLEL_THRESHOLD && TaskPool::parallel();
+    TaskPool::Group group;
+
+    for (int k = parallel ? 1 : 0; k < 3; k++) {
+        if (parallel) {
+            group.run([&, k]() { convolution(residues[k], n, a, an, b, bn, primes[k], inverses[k], squares[k]); });
+        } else {
+            convolution(residues[k], n, a, an, b, bn, primes[k], inverses[k], squares[k]);
+        }
+    }
+    if (parallel) {
+        convolution(residues[0], n, a, an, b, bn, primes[0], inverses[0], squares[0]);
+        group.wait();
+    }
+
+    // Garner: x = r0 + p0·t1 + p0·p1·t2
+    uint64_t p0 = primes[0][0], p1 = primes[1][0], p2 = primes[2][0];
+    uint64_t inv01 = montMul(powMod(p0, p1 - 2, p1), squares[1], p1, inverses[1]);
+    uint64_t p0mod2 = montMul(p0 % p2, squares[2], p2, inverses[2]);
+    uint64_t inv012 = montMul(powMod((uint64_t)((unsigned __int128)p0 * p1 % p2), p2 - 2, p2), squares[2], p2, inverses[2]);
+    unsigned __int128 p01 = (unsigned __int128)p0 * p1;
+    uint64_t p01Low = (uint64_t)p01, p01High = (uint64_t)(p01 >> 64);
+    size_t size = an + bn;
+
+    // Reconstruye r[from .. to) con un acumulador de 192 bits que arrastra el
+    // acarreo de un coeficiente al siguiente. Devuelve en spill lo que pasa
+    // a r[to] y r[to + 1]
+    auto garner = [&](size_t from, size_t to, uint64_t* spill) {
+        uint64_t acc0 = 0, acc1 = 0, acc2 = 0;
+
+        for (size_t i = from; i < to; i++) {
+            if (i < n) {
+                uint64_t x0 = residues[0][i], x1 = residues[1][i], x2 = residues[2][i];
+
+                uint64_t r01 = x0 % p1;
+                uint64_t t1 = montMul(x1 >= r01 ? x1 - r01 : x1 + p1 - r01, inv01, p1, inverses[1]);
+
+                uint64_t y2 = montMul(t1, p0mod2, p2, inverses[2]) + x0 % p2;
+                y2 = y2 >= p2 ? y2 - p2 : y2;
+                uint64_t t2 = montMul(x2 >= y2 ? x2 - y2 : x2 + p2 - y2, inv012, p2, inverses[2]);
+
+                // p0·t1 + r0 cabe en 128 bits; p0·p1·t2 en 192
+                unsigned __int128 low = (unsigned __int128)p0 * t1 + x0;
+                unsigned __int128 mid = (unsigned __int128)p01Low * t2;
+                unsigned __int128 high = (unsigned __int128)p01High * t2;
+
+                unsigned __int128 sum = (unsigned __int128)acc0 + (uint64_t)low + (uint64_t)mid;
+                acc0 = (uint64_t)sum;
+                sum = (sum >> 64) + acc1 + (uint64_t)(low >> 64) + (uint64_t)(mid >> 64) + (uint64_t)high;
+                acc1 = (uint64_t)sum;
+                acc2 += (uint64_t)(sum >> 64) + (uint64_t)(high >> 64);
+            }
+
+            r[i] = acc0;
+            acc0 = acc1;
+            acc1 = acc2;
+            acc2 = 0;
+        }
+
+        spill[0] = acc0;
+        spill[1] = acc1;
+    };
+
+    if (!parallel) {
+        uint64_t spill[2];
+        garner(0, size, spill);
+        return;
+    }
+
+    // Por trozos en paralelo, y después se suma el acarreo de cada trozo al
+    // principio del siguiente
+    size_t chunk = BIGINT_NTT_PARALLEL_THRESHOLD;
+    size_t chunks = (size + chunk - 1) / chunk;
+    std::vector<uint64_t> spills(2 * chunks);
+    for (size_t c = 1; c < chunks; c++) {
+        group.run([&, c]() { garner(c * chunk, std::min(size, (c + 1) * chunk), spills.data() + 2 * c); });
+    }
+    garner(0, std::min(size, chunk), spills.data());
+    group.wait();
+    for (size_t c = 0; c + 1 < chunks; c++) {
+        size_t to = (c + 1) * chunk;
+        addTo(r + to, size - to, spills.data() + 2 * c, std::min<size_t>(2, size - to));
+    }
+}
+
+// Producto de las magnitudes, negativo si negative
+BigInt<2> BigInt<2>::mulMagnitudes(const BigInt<2>& num1, const BigInt<2>& num2, bool negative) {
+
+    // Con dos operandos iguales se pasa el mismo puntero para elevar al cuadrado
+    const Limbs& words = num1.limbs_ == num2.limbs_ ? num1.limbs_ : num2.limbs_;
+
+    BigInt<2> result;
+    result.limbs_.resize(num1.limbs_.size() + num2.limbs_.size());
+    mulWords(result.limbs_.data(), num1.limbs_.data(), num1.limbs_.size(), words.data(), words.size());
+    result.normalize();
+
+    if (negative) {
+        result.negate();
+    }
+
+    return result;
+}
+
+BigInt<2> BigInt<2>::operator*(const BigInt<2>& num) const {
+    int64_t a, b, c;
+    if (toWord(a) && num.toWord(b) && !__builtin_mul_overflow(a, b, &c)) {
+        return BigInt<2>(c);
+    }
+    // Si los signos son diferentes el resultado es negativo
+    return mulMagnitudes(*this, num, sign_ != num.sign_);
+}
+
+// El producto necesita su propia memoria; el resultado sustituye al número
+BigInt<2>& BigInt<2>::operator*=(const BigInt<2>& num) {
+    *this = *this * num;
+    return *this;
+}
+
+
+// División de magnitudes. u tiene un >= vn palabras y v tiene vn palabras con
+// la más alta distinta de cero. Deja el cociente en q (un - vn + 1 palabras) y
+// el resto en r (vn palabras). Elige el algoritmo según el tamaño
+void BigInt<2>::divWords(const uint64_t* u, size_t un, const uint64_t* v, size_t vn, uint64_t* q, uint64_t* r) {
+    if (vn >= BIGINT_BZ_THRESHOLD && un - vn >= BIGINT_BZ_THRESHOLD) {
+        divRecursive(u, un, v, vn, q, r);
+    } else {
+        divBasecase(u, un, v, vn, q, r);
+    }
+}
+
+// División larga de magnitudes (Knuth, algoritmo D), con el mismo contrato
+// que divWords
+void BigInt<2>::divBasecase(const uint64_t* u, size_t un, const uint64_t* v, size_t vn, uint64_t* q, uint64_t* r) {
+
+    // Divisor de una sola palabra
+    if (vn == 1) {
+        unsigned __int128 rest = 0;
+        for (size_t i = un; i-- > 0;) {
+            rest = (rest << 64) | u[i];
+            q[i] = (uint64_t)(rest / v[0]);
+            rest %= v[0];
+        }
+        r[0] = (uint64_t)rest;
+        return;
+    }
+
+    // Normalizar desplazando hasta que el bit alto del divisor sea 1
+    int shift = __builtin_clzll(v[vn - 1]);
+    std::vector<uint64_t> nu(un + 1), nv(vn);
+
+    for (size_t i = vn; i-- > 0;) {
+        nv[i] = (v[i] << shift) | (shift != 0 && i > 0 ? v[i - 1] >> (64 - shift) : 0);
+    }
+    nu[un] = shift != 0 ? u[un - 1] >> (64 - shift) : 0;
+    for (size_t i = un; i-- > 0;) {
+        nu[i] = (u[i] << shift) | (shift != 0 && i > 0 ? u[i - 1] >> (64 - shift) : 0);
+    }
+
+    for (size_t j = un - vn + 1; j-- > 0;) {
+
+        // Estimar la palabra del cociente con las dos palabras altas y
+        // corregirla con la tercera; como mucho sobra una unidad
+        unsigned __int128 top = ((unsigned __int128)nu[j + vn] << 64) | nu[j + vn - 1];
+        unsigned __int128 qhat = top / nv[vn - 1];
+        unsigned __int128 rhat = top % nv[vn - 1];
+
+        while ((qhat >> 64) != 0 || qhat * nv[vn - 2] > ((rhat << 64) | nu[j + vn - 2])) {
+            qhat--;
+            rhat += nv[vn - 1];
+            if ((rhat >> 64) != 0) {
+                break;
+            }
+        }
+
+        // nu[j .. j + vn] -= qhat * nv
+        uint64_t borrow = 0;
+        uint64_t carry = 0;
+        for (size_t i = 0; i < vn; i++) {
+            unsigned __int128 product = qhat * nv[i] + carry;
+            carry = (uint64_t)(product >> 64);
+            uint64_t low = (uint64_t)product;
+            uint64_t diff = nu[i + j] - low;
+            uint64_t underflow = nu[i + j] < low;
+            underflow += diff < borrow;
+            nu[i + j] = diff - borrow;
+            borrow = underflow;
+        }
+        uint64_t word = nu[j + vn];
+        bool negative = word < carry || word - carry < borrow;
+        nu[j + vn] = word - carry - borrow;
+
+        // Si el resultado es negativo qhat era una unidad mayor: se suma v de nuevo
+        if (negative) {
+            qhat--;
+            nu[j + vn] += addTo(nu.data() + j, vn, nv.data(), vn);
+        }
+
+        q[j] = (uint64_t)qhat;
+    }
+
+    // Deshacer la normalización en el resto
+    for (size_t i = 0; i < vn; i++) {
+        r[i] = (nu[i] >> shift) | (shift != 0 ? nu[i + 1] << (64 - shift) : 0);
+    }
+}
+
+// División recursiva de Burnikel-Ziegler, con el mismo contrato que divWords.
+// El divisor se desplaza hasta ocupar exactamente n = j·2^k palabras con el
+// bit alto a 1, y el dividendo se recorre en bloques de n palabras dividiendo
+// cada par de bloques con div2n1n
+void BigInt<2>::divRecursive(const uint64_t* u, size_t un, const uint64_t* v, size_t vn, uint64_t* q, uint64_t* r) {
+
+    size_t m = 1;
+    while (vn / m >= BIGINT_BZ_THRESHOLD) {
+        m <<= 1;
+    }
+    size_t n = (vn + m - 1) / m * m;
+
+    // Desplazamiento en bits para normalizar el divisor a n palabras
+    size_t vbits = (vn - 1) * 64 + 64 - __builtin_clzll(v[vn - 1]);
+    size_t sigma = n * 64 - vbits;
+    size_t wordShift = sigma / 64;
+    int bitShift = sigma % 64;
+
+    // Bloques del dividendo: el más alto siempre deja libre el bit superior
+    size_t ubits = (un - 1) * 64 + 64 - __builtin_clzll(u[un - 1]) + sigma;
+    size_t t = std::max<size_t>((ubits + n * 64) / (n * 64), 2);
+
+    std::vector<uint64_t> b(n, 0), a(t * n, 0);
+    for (size_t i = 0; i < vn; i++) {
+        b[i + wordShift] |= v[i] << bitShift;
+        if (bitShift != 0 && i + wordShift + 1 < n) {
+            b[i + wordShift + 1] |= v[i] >> (64 - bitShift);
+        }
+    }
+    for (size_t i = 0; i < un; i++) {
+        a[i + wordShift] |= u[i] << bitShift;
+        if (bitShift != 0 && i + wordShift + 1 < t * n) {
+            a[i + wordShift + 1] |= u[i] >> (64 - bitShift);
+        }
+    }
+
+    std::vector<uint64_t> quotient((t - 1) * n, 0);
+    std::vector<uint64_t> z(2 * n), rest(n);
+    std::copy(a.begin() + (t - 2) * n, a.end(), z.begin());
+
+    for (size_t i = t - 1; i-- > 0;) {
+        div2n1n(z.data(), b.data(), n, quotient.data() + i * n, rest.data());
+        if (i > 0) {
+            std::copy(a.begin() + (i - 1) * n, a.begin() + i * n, z.begin());
+            std::copy(rest.begin(), rest.end(), z.begin() + n);
+        }
+    }
+
+    size_t qn = std::min(quotient.size(), un - vn + 1);
+    std::copy(quotient.begin(), quotient.begin() + qn, q);
+    std::fill(q + qn, q + (un - vn + 1), 0);
+
+    // Deshacer el desplazamiento en el resto
+    for (size_t i = 0; i < vn; i++) {
+        size_t index = i + wordShift;
+        r[i] = rest[index] >> bitShift;
+        if (bitShift != 0 && index + 1 < n) {
+            r[i] |= rest[index + 1] << (64 - bitShift);
+        }
+    }
+}
+
+// a (2n palabras) entre b (n palabras, bit alto a 1) con a < b·B^n.
+// Cociente de n palabras en q y resto de n palabras en r
+void BigInt<2>::div2n1n(const uint64_t* a, const uint64_t* b, size_t n, uint64_t* q, uint64_t* r) {
+
+    if (n % 2 != 0 || n < BIGINT_BZ_THRESHOLD) {
+        std::vector<uint64_t> quotient(n + 1);
+        divBasecase(a, 2 * n, b, n, quotient.data(), r);
+        std::copy(quotient.begin(), quotient.begin() + n, q);
+        return;
+    }
+
+    size_t half = n / 2;
+
+    // [a1 a2 a3] entre b y después [r a4] entre b
+    std::vector<uint64_t> temp(3 * half);
+    div3n2n(a + half, b, half, q + half, r);
+    std::copy(a, a + half, temp.begin());
+    std::copy(r, r + n, temp.begin() + half);
+    div3n2n(temp.data(), b, half, q, r);
+}
+
+// a (3·half palabras) entre b (2·half palabras, bit alto a 1) con
+// a < b·B^half. Cociente de half palabras en q y resto de 2·half en r
+void BigInt<2>::div3n2n(const uint64_t* a, const uint64_t* b, size_t half, uint64_t* q, uint64_t* r) {
+
+    size_t n = 2 * half;
+    const uint64_t* b1 = b + half;
+    const uint64_t* b2 = b;
+
+    // x = [r1 a3] con una palabra más para el acarreo
+    std::vector<uint64_t> x(n + 1, 0);
+
+    if (compareWords(a + n, half, b1, half) < 0) {
+        // q = [a1 a2] / b1, r1 = [a1 a2] % b1
+        div2n1n(a + half, b1, half, q, x.data() + half);
+    } else {
+        // Como a < b·B^half, a1 == b1: q = B^half - 1 y
+        // r1 = [a1 a2] - q·b1 = a2 + b1, que ocupa half + 1 palabras
+        std::fill(q, q + half, ~uint64_t(0));
+        std::copy(a + half, a + n, x.begin() + half);
+        addTo(x.data() + half, half + 1, b1, half);
+    }
+    std::copy(a, a + half, x.begin());
+
+    // x -= q·b2; mientras sea negativo se suma b y se resta uno al cociente
+    std::vector<uint64_t> d(n);
+    mulWords(d.data(), q, half, b2, half);
+
+    if (subFrom(x.data(), n + 1, d.data(), n) != 0) {
+        do {
+            uint64_t one = 1;
+            subFrom(q, half, &one, 1);
+        } while (addTo(x.data(), n + 1, b, n) == 0);
+    }
+
+    std::copy(x.begin(), x.begin() + n, r);
+}
+
+// Cociente truncado hacia cero y resto con el signo del dividendo, de forma
+// que dividend = quotient * divisor + remainder
+void BigInt<2>::divide(const BigInt<2>& dividend, const BigInt<2>& divisor, BigInt<2>* quotient, BigInt<2>* remainder) {
+
+    if (divisor.limbs_.empty()) {
+        std::cout << "Division by zero" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    // INT64_MIN / -1 no cabe en una palabra y sigue el camino general.
+    // Cociente y resto se calculan antes de escribir, por si son operandos
+    int64_t a, b;
+    if (dividend.toWord(a) && divisor.toWord(b) && !(a == INT64_MIN && b == -1)) {
+        int64_t q = a / b;
+        int64_t r = a % b;
+        if (quotient != nullptr) {
+            quotient->assignWord(q);
+        }
+        if (remainder != nullptr) {
+            remainder->assignWord(r);
+        }
+        return;
+    }
+
+    BigInt<2> result;
+    BigInt<2> rest;
+
+    if (compareWords(dividend.limbs_.data(), dividend.limbs_.size(), divisor.limbs_.data(), divisor.limbs_.size()) < 0) {
+        if (remainder != nullptr) {
+            rest.limbs_ = dividend.limbs_;
+        }
+    } else {
+        size_t un = dividend.limbs_.size();
+        size_t vn = divisor.limbs_.size();
+        result.limbs_.resize(un - vn + 1);
+        rest.limbs_.resize(vn);
+        divWords(dividend.limbs_.data(), un, divisor.limbs_.data(), vn, result.limbs_.data(), rest.limbs_.data());
+    }
+
+    if (quotient != nullptr) {
+        // Si los signos son diferentes el resultado es negativo
+        result.sign_ = dividend.sign_ != divisor.sign_ ? 1 : 0;
+        result.normalize();
+        *quotient = std::move(result);
+    }
+
+    if (remainder != nullptr) {
+        rest.sign_ = dividend.sign_;
+        rest.normalize();
+        *remainder = std::move(rest);
+    }
+}
+
+BigInt<2> operator/(const BigInt<2>& dividend, const BigInt<2>& divisor) {
+    BigInt<2> result;
+    BigInt<2>::divide(dividend, divisor, &result, nullptr);
+    return result;
+}
+
+BigInt<2> BigInt<2>::operator%(const BigInt<2>& num) const {
+    BigInt<2> result;
+    divide(*this, num, nullptr, &result);
+    return result;
+}
+
+// divide lee los operandos antes de escribir el resultado, así que este
+// puede ser el propio dividendo
+BigInt<2>& BigInt<2>::operator/=(const BigInt<2>& num) {
+    divide(*this, num, this, nullptr);
+    return *this;
+}
+
+BigInt<2>& BigInt<2>::operator%=(const BigInt<2>& num) {
+    divide(*this, num, nullptr, this);
+    return *this;
+}
+
+// Devuelve (dividend / divisor, dividend % divisor) con una sola división
+std::pair<BigInt<2>, BigInt<2>> divmod(const BigInt<2>& dividend, const BigInt<2>& divisor) {
+    std::pair<BigInt<2>, BigInt<2>> result;
+    BigInt<2>::divide(dividend, divisor, &result.first, &result.second);
+    return result;
+}
+
+// Exponenciación binaria recorriendo los bits del exponente de mayor a menor:
+// en cada paso se eleva al cuadrado y, si el bit es 1, se multiplica por la base
+BigInt<2> pow(const BigInt<2>& a, const BigInt<2>& b) {
+
+    if (b.sign_ == 1) {
+        std::cerr << "Error: el exponente no puede ser negativo." << std::endl;
+        return BigInt<2>();
+    }
+
+    BigInt<2> result(1L);
+
+    if (a.limbs_.empty() && !b.limbs_.empty()) {
+        return BigInt<2>();
+    }
+
+    Limbs temp;
+    Limbs& words = result.limbs_;
+
+    for (size_t i = b.bitLength(); i-- > 0;) {
+
+        temp.resize(2 * words.size());
+        BigInt<2>::mulWords(temp.data(), words.data(), words.size(), words.data(), words.size());
+        while (!temp.empty() && temp.back() == 0) {
+            temp.pop_back();
+        }
+        words.swap(temp);
+
+        if ((b.limbs_[i / 64] >> (i % 64)) & 1) {
+            temp.resize(words.size() + a.limbs_.size());
+            BigInt<2>::mulWords(temp.data(), words.data(), words.size(), a.limbs_.data(), a.limbs_.size());
+            while (!temp.empty() && temp.back() == 0) {
+                temp.pop_back();
+            }
+            words.swap(temp);
+        }
+    }
+
+    // Base negativa y exponente impar
+    if (a.sign_ == 1 && !b.limbs_.empty() && (b.limbs_[0] & 1)) {
+        result.negate();
+    }
+
+    return result;
+}
+
+
+// Flow Operators
+std::ostream &operator<<(std::ostream &os, const BigInt<2> &num) {
+    return os << num.toString();
+}
+
+std::istream &operator>>(std::istream &is, BigInt<2> &num) {
+    std::string str;
+    is >> str;
+    num = BigInt<2>(str);
+    return is;
+}
+
+// Bit de signo seguido del cuerpo mínimo en complemento a dos: hasta el bit
+// más alto distinto de la extensión, y al menos uno
+std::string BigInt<2>::toString() const {
+
+    Limbs words;
+    complement(words);
+    uint64_t ext = extension();
+
+    size_t size = 1;
+    for (size_t i = words.size(); i-- > 0;) {
+        uint64_t word = words[i] ^ ext;
+        if (word != 0) {
+            size = i * 64 + 64 - __builtin_clzll(word);
+            break;
+        }
+    }
+
+    std::string str(size + 1, '0');
+    str[0] = sign_ == 1 ? '1' : '0';
+
+    for (size_t i = 0; i < size; i += 64) {
+        uint64_t word = i / 64 < words.size() ? words[i / 64] : ext;
+        size_t count = std::min<size_t>(64, size - i);
+        for (size_t j = 0; j < count; j++) {
+            if ((word >> j) & 1) {
+                str[size - i - j] = '1';
+            }
+        }
+    }
+
+    return str;
+}
+
+// Texto en complemento a dos (mismo formato que el constructor) a octal con
+// signo, agrupando los bits de tres en tres
+std::string BigInt<2>::binaryToOctal(std::string binaryStr) {
+
+    BigInt<2> value(binaryStr);
+
+    if (value.limbs_.empty()) {
+        return "0";
+    }
+
+    size_t count = (value.bitLength() + 2) / 3;
+    std::string str(count, '0');
+    for (size_t i = 0; i < count; i++) {
+        str[count - 1 - i] = (char)('0' + value.bits(3 * i, 3));
+    }
+
+    if (value.sign_ == 1) {
+        str.insert(str.begin(), '-');
+    }
+
+    return str;
+}
+
+// Cambio de tipo
+
+template <size_t Base>
+BigInt<2>::operator BigInt<Base>() const {
+
+    BigInt<Base> result;
+
+    switch (Base) {
+        case 2:
+            return *this;
+            break;
+
+        case 8:
+        case 16:
+            {
+                // Cada palabra de la base destino son limbBits bits consecutivos
+                const size_t limbBits = __builtin_ctzll(BigInt<Base>::LimbBase);
+                size_t count = (bitLength() + limbBits - 1) / limbBits;
+
+                result.limbs_.resize(count);
+                for (size_t i = 0; i < count; i++) {
+                    result.limbs_[i] = bits(i * limbBits, limbBits);
+                }
+
+                break;
+            }
+
+        default:
+            {
+                // Cada palabra de la base destino aporta al menos limbBits
+                // bits, lo que acota el número de palabras del resultado
+                const size_t limbBits = 63 - __builtin_clzll(BigInt<Base>::LimbBase);
+                size_t count = bitLength() / limbBits + 1;
+
+                result.limbs_.resize(count);
+                BigInt<Base>::wordsToLimbs(limbs_.data(), limbs_.size(), result.limbs_.data(), count);
+
+                break;
+            }
+    }
+
+    result.normalize();
+
+    if (sign_ == 1) {
+        result.setSign(-1);
+    }
+
+    return result;
+}
+
+
+
+
+// Número de cifras de la base que caben en una palabra sin superar 2^62, de
+// forma que la suma de dos palabras más el acarreo nunca desborde 64 bits
+constexpr size_t limbDigits(size_t base) {
+    size_t count = 0;
+    for (uint64_t power = 1; base > 1 && power <= (uint64_t(1) << 62) / base; power *= base) {
+        count++;
+    }
+    return count;
+}
+
+constexpr uint64_t limbBase(size_t base) {
+    uint64_t power = 1;
+    for (size_t i = 0; i < limbDigits(base); i++) {
+        power *= base;
+    }
+    return power;
+}
+
+template <size_t Base = 10>
+class BigInt {
+
+    private:
+        static bool checkBase();
+        static bool checkDigits(char digit);
+
+        // Las cifras se agrupan en palabras de LimbDigits cifras: cada palabra
+        // es una cifra en base LimbBase (10^18 para la base 10, 16^15 para la
+        // 16 y 8^20 para la 8), la menos significativa primero
+        static constexpr size_t LimbDigits = limbDigits(Base);
+        static constexpr uint64_t LimbBase = limbBase(Base);
+
+        // LimbBase desplazado hasta tener el bit alto a uno y su inverso
+        // floor((2^128 - 1) / divisor) - 2^64, para dividir sin __int128
+        static constexpr int LimbShift = __builtin_clzll(LimbBase);
+        static constexpr uint64_t LimbInverse = (uint64_t)(~(unsigned __int128)0 / (LimbBase << LimbShift));
+
+        Limbs limbs_;
+        int sign_;
+
+        void parse(const std::string& value);
+        void normalize();
+
+        // Camino rápido para los valores de una sola palabra
+        bool toWord(int64_t& value) const;
+        void assignWord(int64_t value);
+
+        static int compareLimbs(const Limbs&, const Limbs&);
+        static void addLimbs(Limbs&, const Limbs&, const Limbs&);
+        static void subLimbs(Limbs&, const Limbs&, const Limbs&);
+        static void add(BigInt<Base>& result, const BigInt<Base>&, const BigInt<Base>&, bool subtract);
+        static uint64_t splitLimb(unsigned __int128 value, uint64_t& quotient);
+        static uint64_t mulAddLimbs(uint64_t* r, const uint64_t* a, size_t n, uint64_t b);
+        static Limbs mulLimbs(const Limbs&, const Limbs&);
+        static Limbs sqrLimbs(const Limbs&);
+        static void divLimbs(const Limbs&, const Limbs&, Limbs&, Limbs&);
+        static void divide(const BigInt<Base>& dividend, const BigInt<Base>& divider, BigInt<Base>* quotient, BigInt<Base>* remainder);
+
+        static const std::vector<uint64_t>& limbPower(size_t level);
+        static void limbsToWords(const uint64_t* limbs, size_t n, Limbs& words);
+        static void wordsToLimbs(const uint64_t* words, size_t n, uint64_t* limbs, size_t count);
+
+        friend class BigInt<2>;
+
+    public:
+        BigInt(long value = 0);
+        BigInt(std::string& value);
+        BigInt(const char* value);
+        BigInt(const BigInt<Base>& value);
+        BigInt(BigInt<Base>&& value) noexcept;
+        ~BigInt() = default;
+
+        // Asignment Operators
+        BigInt<Base>& operator=(const BigInt<Base>& num);
+        BigInt<Base>& operator=(BigInt<Base>&& num) noexcept;
+
+        // Flow Operators
+        friend std::ostream &operator<<<Base>(std::ostream &, const BigInt<Base> &);
+        friend std::istream &operator>><Base>(std::istream &, BigInt<Base> &);
+
+        // Accesor Methods
+        int sign() const; 
+        char operator[](int) const; 
+
+        //Setters
+        void setSign(int sign);
+
+        // Mensaje del error con el que saldrían los constructores, o nullptr
+        static const char* check(const std::string& value);
+
+        // Libera la memoria que el valor ya no usa
+        void shrink_to_fit();
+
+        // Comparison Operators
+        int compare(const BigInt<Base>& num) const;
+        friend bool operator==<Base>(const BigInt<Base>& num1, const BigInt<Base>& num2);
+        bool operator!=(const BigInt<Base>& num) const;
+        friend bool operator><Base>(const BigInt<Base>& num1, const BigInt<Base>& num2);
+        bool operator>=(const BigInt<Base>& num) const;
+        friend bool operator< <Base>(const BigInt<Base>& num1, const BigInt<Base>& num2);
+        bool operator<=(const BigInt<Base>& num) const;
+
+        // Increment and Decrement Operators
+        BigInt<Base>& operator++(); 
+        BigInt<Base> operator++(int value); 
+        BigInt<Base>& operator--(); 
+        BigInt<Base> operator--(int value); 
+
+        // Arithmetic Operators
+        friend BigInt<Base> operator+<Base>(const BigInt<Base>&, const BigInt<Base>&);
+        friend BigInt<Base> operator+<Base>(BigInt<Base>&&, const BigInt<Base>&);
+        friend BigInt<Base> operator+<Base>(const BigInt<Base>&, BigInt<Base>&&);
+        friend BigInt<Base> operator+<Base>(BigInt<Base>&&, BigInt<Base>&&);
+        friend BigInt<Base> operator-<Base>(BigInt<Base>&&, const BigInt<Base>&);
+        friend BigInt<Base> operator-<Base>(const BigInt<Base>&, BigInt<Base>&&);
+        friend BigInt<Base> operator-<Base>(BigInt<Base>&&, BigInt<Base>&&);
+        friend BigInt<Base> operator-<Base>(BigInt<Base>&&);
+        BigInt<Base> operator-(const BigInt<Base> &) const;
+        BigInt<Base> operator-() const;
+        BigInt<Base> operator*(const BigInt<Base>&) const;
+        friend BigInt<Base> operator/<Base>(const BigInt<Base>&, const BigInt<Base>&);
+        BigInt<Base> operator%(const BigInt<Base>&) const;
+        friend std::pair<BigInt<Base>, BigInt<Base>> divmod<Base>(const BigInt<Base>&, const BigInt<Base>&);
+
+        // Compound Assignment Operators (sobre la memoria del propio número)
+        BigInt<Base>& operator+=(const BigInt<Base>&);
+        BigInt<Base>& operator-=(const BigInt<Base>&);
+        BigInt<Base>& operator*=(const BigInt<Base>&);
+        BigInt<Base>& operator/=(const BigInt<Base>&);
+        BigInt<Base>& operator%=(const BigInt<Base>&);
+
+        // Pow
+        friend BigInt<Base> pow<Base>(const BigInt<Base>&, const BigInt<Base>&);
+
+        // Type Conversion
+
+        operator BigInt<2>() const {
+
+            BigInt<2> result;
+
+            switch (Base) {
+                case 8:
+                case 16:
+                    {
+                        // Cada palabra son exactamente limbBits bits: se colocan
+                        // directamente en las palabras de 64 bits
+                        const size_t limbBits = __builtin_ctzll(LimbBase);
+
+                        result.limbs_.assign((limbs_.size() * limbBits + 63) / 64, 0);
+
+                        for (size_t i = 0; i < limbs_.size(); i++) {
+                            size_t position = i * limbBits;
+                            result.limbs_[position / 64] |= limbs_[i] << (position % 64);
+                            if (position % 64 + limbBits > 64) {
+                                result.limbs_[position / 64 + 1] |= limbs_[i] >> (64 - position % 64);
+                            }
+                        }
+
+                        break;
+                    }
+
+                default:
+                    {
+                        limbsToWords(limbs_.data(), limbs_.size(), result.limbs_);
+                        break;
+                    }
+            }
+
+            result.normalize();
+
+            if (sign_ == -1) {
+                result.negate();
+            }
+
+            return result;
+        }
+
+
+};
+
+template <size_t Base>
+constexpr size_t BigInt<Base>::LimbDigits;
+
+// LimbBase^(2^level) en palabras binarias. La tabla se calcula elevando al
+// cuadrado la potencia anterior y se conserva durante todo el proceso; al ser
+// un deque las referencias devueltas siguen siendo válidas cuando crece. El
+// cerrojo permite convertir valores desde varios hilos a la vez
+template <size_t Base>
+const std::vector<uint64_t>& BigInt<Base>::limbPower(size_t level) {
+
+    static std::deque<std::vector<uint64_t>> powers(1, std::vector<uint64_t>(1, LimbBase));
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+
+    while (powers.size() <= level) {
+        const std::vector<uint64_t>& last = powers.back();
+        std::vector<uint64_t> square(2 * last.size());
+        BigInt<2>::mulWords(square.data(), last.data(), last.size(), last.data(), last.size());
+        while (!square.empty() && square.back() == 0) {
+            square.pop_back();
+        }
+        powers.push_back(square);
+    }
+
+    return powers[level];
+}
+
+// Pasa n palabras en base LimbBase a palabras binarias. Por encima del umbral
+// se parte en alta·LimbBase^half + baja, con half la mayor potencia de dos
+// menor que n, y se recombina con la multiplicación rápida
+template <size_t Base>
+void BigInt<Base>::limbsToWords(const uint64_t* limbs, size_t n, Limbs& words) {
+
+    words.clear();
+
+    if (n <= BIGINT_RADIX_THRESHOLD) {
+        // Horner: words = words * LimbBase + palabra
+        for (size_t i = n; i-- > 0;) {
+            uint64_t carry = limbs[i];
+            for (size_t j = 0; j < words.size(); j++) {
+                unsigned __int128 product = (unsigned __int128)words[j] * LimbBase + carry;
+                words[j] = (uint64_t)product;
+                carry = (uint64_t)(product >> 64);
+            }
+            if (carry != 0) {
+                words.push_back(carry);
+            }
+        }
+        return;
+    }
+
+    size_t level = 0;
+    while ((size_t(2) << level) < n) {
+        level++;
+    }
+    size_t half = size_t(1) << level;
+
+    Limbs high, low;
+    limbsToWords(limbs + half, n - half, high);
+    limbsToWords(limbs, half, low);
+
+    const std::vector<uint64_t>& power = limbPower(level);
+    words.assign(high.size() + power.size(), 0);
+    if (!high.empty()) {
+        BigInt<2>::mulWords(words.data(), high.data(), high.size(), power.data(), power.size());
+    }
+    BigInt<2>::addTo(words.data(), words.size(), low.data(), low.size());
+
+    while (!words.empty() && words.back() == 0) {
+        words.pop_back();
+    }
+}
+
+// Operación inversa: n palabras binarias con valor menor que LimbBase^count a
+// exactamente count palabras en base LimbBase. Por encima del umbral se divide
+// entre LimbBase^half y se convierten cociente y resto por separado
+template <size_t Base>
+void BigInt<Base>::wordsToLimbs(const uint64_t* words, size_t n, uint64_t* limbs, size_t count) {
+
+    while (n > 0 && words[n - 1] == 0) {
+        n--;
+    }
+
+    if (n <= BIGINT_RADIX_THRESHOLD) {
+        // Dividir las palabras entre LimbBase y quedarse con los restos
+        std::vector<uint64_t> rest(words, words + n);
+        size_t size = 0;
+
+        while (!rest.empty()) {
+            unsigned __int128 remainder = 0;
+            for (size_t i = rest.size(); i-- > 0;) {
+                unsigned __int128 current = (remainder << 64) | rest[i];
+                rest[i] = (uint64_t)(current / LimbBase);
+                remainder = current % LimbBase;
+            }
+            while (!rest.empty() && rest.back() == 0) {
+                rest.pop_back();
+            }
+            limbs[size++] = (uint64_t)remainder;
+        }
+
+        std::fill(limbs + size, limbs + count, 0);
+        return;
+    }
+
+    size_t level = 0;
+    while ((size_t(2) << level) < count) {
+        level++;
+    }
+    size_t half = size_t(1) << level;
+
+    const std::vector<uint64_t>& power = limbPower(level);
+    size_t pn = power.size();
+
+    if (BigInt<2>::compareWords(words, n, power.data(), pn) < 0) {
+        std::fill(limbs + half, limbs + count, 0);
+        wordsToLimbs(words, n, limbs, half);
+        return;
+    }
+
+    std::vector<uint64_t> quotient(n - pn + 1), rest(pn);
+    BigInt<2>::divWords(words, n, power.data(), pn, quotient.data(), rest.data());
+
+    wordsToLimbs(quotient.data(), quotient.size(), limbs + half, count - half);
+    wordsToLimbs(rest.data(), rest.size(), limbs, half);
+}
+
+template <size_t Base>
+constexpr uint64_t BigInt<Base>::LimbBase;
+
+template <size_t Base>
+constexpr int BigInt<Base>::LimbShift;
+
+template <size_t Base>
+constexpr uint64_t BigInt<Base>::LimbInverse;
+
+// Check Methods
+
+template <size_t Base>
+bool BigInt<Base>::checkBase() {
+    if (Base == 2 || Base == 8 || Base == 10 || Base == 16)
+        return true;
+
+    return false;
+}
+
+template <size_t Base>
+bool BigInt<Base>::checkDigits(char digit) {
+    switch(Base) {
+        case 2:     
+            if (digit == '0' || digit == '1')
+                return true;
+            break;
+        case 8:
+            if (digit >= '0' && digit <= '7')
+                return true;
+            break;
+        case 10:
+            if (digit >= '0' && digit <= '9')
+                return true;
+            break;
+        case 16:
+            if ((digit >= '0' && digit <= '9') || (digit >= 'A' && digit <= 'F'))
+                return true;
+            break;
+        default:
+            break;
+    }
+    return false;
+}
+
+// Constructors
+
+template <size_t Base>
+BigInt<Base>::BigInt(long value) {
+    if(!checkBase()) {
+        std::cout << "Base is not supported" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    assignWord(value);
+}
+
+// LimbBase <= 2^60: una palabra cabe en un int64_t y la suma de dos también
+template <size_t Base>
+bool BigInt<Base>::toWord(int64_t& value) const {
+    if (limbs_.size() > 1) {
+        return false;
+    }
+    value = limbs_.empty() ? 0 : sign_ * static_cast<int64_t>(limbs_[0]);
+    return true;
+}
+
+template <size_t Base>
+void BigInt<Base>::assignWord(int64_t value) {
+    limbs_.clear();
+    sign_ = value < 0 ? -1 : 1;
+
+    uint64_t magnitude = value < 0 ? -(uint64_t)value : (uint64_t)value;
+    while(magnitude > 0) {
+        limbs_.push_back(magnitude % LimbBase);
+        magnitude /= LimbBase;
+    }
+}
+
+template <size_t Base>
+BigInt<Base>::BigInt(std::string& value) {
+    parse(value);
+}
+
+template <size_t Base>
+BigInt<Base>::BigInt(const char* value) {
+    parse(std::string(value));
+}
+
+template <size_t Base>
+BigInt<Base>::BigInt(const BigInt<Base>& value) {
+    limbs_ = value.limbs_;
+    sign_ = value.sign_;
+}
+
+// El número movido queda a cero
+template <size_t Base>
+BigInt<Base>::BigInt(BigInt<Base>&& value) noexcept : limbs_(std::move(value.limbs_)), sign_(value.sign_) {
+    value.limbs_.clear();
+    value.sign_ = 1;
+}
+
+// Mensaje del error con el que saldría el constructor al leer value, o
+// nullptr si es un número válido en la base
+template <size_t Base>
+const char* BigInt<Base>::check(const std::string& value) {
+
+    if (!checkBase()) {
+        return "Base is not supported";
+    }
+
+    size_t start = 0;
+    if (value[0] == '-' || value[0] == '+') {
+        start = 1;
+    } else if (!((value[0] >= '0' && value[0] <= '9') || (value[0] >= 'A' && value[0] <= 'F'))) {
+        return "Invalid number";
+    }
+
+    for (size_t i = start; i < value.size(); i++) {
+        if (!checkDigits(value[i])) {
+            return "Digit is not supported";
+        }
+    }
+    return nullptr;
+}
+
+// Las cifras se leen de derecha a izquierda y se acumulan en palabras de
+// LimbDigits cifras
+template <size_t Base>
+void BigInt<Base>::parse(const std::string& value) {
+
+    const char* error = check(value);
+    if (error != nullptr) {
+        std::cout << error << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    size_t start = value[0] == '-' || value[0] == '+' ? 1 : 0;
+    sign_ = value[0] == '-' ? -1 : 1;
+
+    limbs_.clear();
+    limbs_.reserve((value.size() - start) / LimbDigits + 1);
+
+    uint64_t limb = 0;
+    uint64_t power = 1;
+
+    for (size_t i = value.size(); i-- > start;) {
+        uint64_t digit = value[i] <= '9' ? value[i] - '0' : value[i] - 'A' + 10;
+        limb += digit * power;
+        power *= Base;
+
+        if (power == LimbBase) {
+            limbs_.push_back(limb);
+            limb = 0;
+            power = 1;
+        }
+    }
+
+    if (power != 1) {
+        limbs_.push_back(limb);
+    }
+
+    normalize();
+}
+
+// Elimina las palabras altas a cero. El cero siempre es positivo
+template <size_t Base>
+void BigInt<Base>::normalize() {
+    while (!limbs_.empty() && limbs_.back() == 0) {
+        limbs_.pop_back();
+    }
+    if (limbs_.empty()) {
+        sign_ = 1;
+    }
+}
+
+// Asignment Operators
+
+template <size_t Base>
+BigInt<Base>& BigInt<Base>::operator=(const BigInt<Base>& num) {
+    limbs_ = num.limbs_;
+    sign_ = num.sign_;
+    return *this;
+}
+
+template <size_t Base>
+BigInt<Base>& BigInt<Base>::operator=(BigInt<Base>&& num) noexcept {
+    if (this != &num) {
+        limbs_.swap(num.limbs_);
+        sign_ = num.sign_;
+        num.limbs_.clear();
+        num.sign_ = 1;
+    }
+    return *this;
+}
+
+// Flow operators
+template <size_t Base>
+std::ostream &operator<<(std::ostream &os, const BigInt<Base> &n) {
+
+    const char* symbols = "0123456789ABCDEF";
+
+    if (n.limbs_.empty()) {
+        return os << "0";
+    }
+
+    std::string str;
+    str.reserve(n.limbs_.size() * BigInt<Base>::LimbDigits + 1);
+
+    if (n.sign_ == -1)
+        str += "-";
+
+    // La palabra más alta sin ceros a la izquierda, el resto con todas sus cifras
+    std::string limb;
+    for (size_t i = n.limbs_.size(); i-- > 0;) {
+        uint64_t value = n.limbs_[i];
+        limb.assign(BigInt<Base>::LimbDigits, '0');
+        for (size_t j = BigInt<Base>::LimbDigits; j-- > 0 && value > 0;) {
+            limb[j] = symbols[value % Base];
+            value /= Base;
+        }
+        if (i == n.limbs_.size() - 1) {
+            limb.erase(0, std::min(limb.find_first_not_of('0'), limb.size() - 1));
+        }
+        str += limb;
+    }
+
+    return os << str;
+}
+
+template <size_t Base>
+std::istream &operator>>(std::istream &is, BigInt<Base> &n) {
+  std::string str;
+  is >> str;
+  n = BigInt<Base>(str);
+  return is;
+}
+
+// Accesor Methods
+
+template <size_t Base>
+int BigInt<Base>::sign() const {
+    return sign_;
+}
+
+template <size_t Base>
+char BigInt<Base>::operator[](int index) const {
+    int size = 0;
+    if (!limbs_.empty()) {
+        size = (limbs_.size() - 1) * LimbDigits;
+        for (uint64_t top = limbs_.back(); top > 0; top /= Base) {
+            size++;
+        }
+    }
+    if (index < 0 || index >= size) {
+        std::cout << "Index out of range" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    uint64_t value = limbs_[index / LimbDigits];
+    for (size_t i = 0; i < index % LimbDigits; i++) {
+        value /= Base;
+    }
+    return "0123456789ABCDEF"[value % Base];
+}
+
+// Setters
+
+template <size_t Base>
+void BigInt<Base>::setSign(int sign) {
+    sign_ = limbs_.empty() ? 1 : sign;
+}
+
+template <size_t Base>
+void BigInt<Base>::shrink_to_fit() {
+    limbs_.shrink_to_fit();
+}
+
+
+// Comparison Operators
+
+// Compara las magnitudes: -1, 0 o 1
+template <size_t Base>
+int BigInt<Base>::compareLimbs(const Limbs& num1, const Limbs& num2) {
+    if (num1.size() != num2.size())
+        return num1.size() > num2.size() ? 1 : -1;
+
+    return Kernels::instance().compare(num1.data(), num2.data(), num1.size());
+}
+
+// Devuelve -1, 0 o 1: primero el signo, luego la longitud y por último las
+// palabras desde la más alta
+template <size_t Base>
+int BigInt<Base>::compare(const BigInt<Base>& num) const {
+    if (sign_ != num.sign_)
+        return sign_;
+
+    return sign_ * compareLimbs(limbs_, num.limbs_);
+}
+
+template <size_t Base>
+bool operator==(const BigInt<Base>& num1, const BigInt<Base>& num2) {
+    return num1.sign_ == num2.sign_ && num1.limbs_ == num2.limbs_;
+}
+
+template <size_t Base>
+bool BigInt<Base>::operator!=(const BigInt<Base>& num) const {
+    return !(*this == num);
+}
+
+template <size_t Base>
+bool operator>(const BigInt<Base>& num1, const BigInt<Base>& num2) {
+    return num1.compare(num2) > 0;
+}
+
+template <size_t Base>
+bool BigInt<Base>::operator>=(const BigInt<Base>& num) const {
+    return compare(num) >= 0;
+}
+
+template <size_t Base>
+bool operator<(const BigInt<Base> &num1, const BigInt<Base> &num2) {
+  return num1.compare(num2) < 0;
+}
+
+template <size_t Base>
+bool BigInt<Base>::operator<=(const BigInt<Base>& num) const {
+    return compare(num) <= 0;
+}
+
+// Increment and Decrement Operators
+
+template <size_t Base>
+BigInt<Base>& BigInt<Base>::operator++() {
+    return *this += BigInt<Base>(1);
+}
+
+template <size_t Base>
+BigInt<Base> BigInt<Base>::operator++(int) {
+    BigInt<Base> temp(*this);
+    ++(*this);
+    return temp;
+}
+
+template <size_t Base>
+BigInt<Base>& BigInt<Base>::operator--() {
+    return *this -= BigInt<Base>(1);
+}
+
+template <size_t Base>
+BigInt<Base> BigInt<Base>::operator--(int) {
+    BigInt<Base> temp(*this);
+    --(*this);
+    return temp;
+}
+
+// Arithmetic Operators
+
+// Operaciones sobre magnitudes en base LimbBase
+
+// result puede ser uno de los operandos: cada palabra se lee antes de
+// escribirla y los tamaños se toman antes de agrandar result
+template <size_t Base>
+void BigInt<Base>::addLimbs(Limbs& result, const Limbs& num1, const Limbs& num2) {
+    size_t size1 = num1.size();
+    size_t size2 = num2.size();
+    size_t size = std::max(size1, size2);
+
+    result.resize(size + 1);
+    uint64_t carry = 0;
+
+    for (size_t i = 0; i < size; i++) {
+        uint64_t sum = (i < size1 ? num1[i] : 0) + (i < size2 ? num2[i] : 0) + carry;
+        carry = sum >= LimbBase;
+        result[i] = carry ? sum - LimbBase : sum;
+    }
+    result[size] = carry;
+}
+
+// Requiere num1 >= num2. result puede ser uno de los operandos
+template <size_t Base>
+void BigInt<Base>::subLimbs(Limbs& result, const Limbs& num1, const Limbs& num2) {
+    size_t size1 = num1.size();
+    size_t size2 = num2.size();
+
+    result.resize(size1);
+    uint64_t borrow = 0;
+
+    for (size_t i = 0; i < size1; i++) {
+        uint64_t minuend = num1[i];
+        uint64_t subtrahend = (i < size2 ? num2[i] : 0) + borrow;
+        borrow = minuend < subtrahend;
+        result[i] = borrow ? minuend + LimbBase - subtrahend : minuend - subtrahend;
+    }
+}
+
+// Divide value entre LimbBase: devuelve el resto y deja en quotient el
+// cociente, que tiene que caber en una palabra. Con el inverso precalculado
+// basta con dos productos y dos correcciones (Möller-Granlund) en lugar de
+// las divisiones de 128 bits, que son llamadas a la biblioteca
+template <size_t Base>
+uint64_t BigInt<Base>::splitLimb(unsigned __int128 value, uint64_t& quotient) {
+    const uint64_t divisor = LimbBase << LimbShift;
+    value <<= LimbShift;
+    uint64_t high = (uint64_t)(value >> 64);
+    uint64_t low = (uint64_t)value;
+
+    unsigned __int128 estimate = (unsigned __int128)LimbInverse * high + value;
+    uint64_t q = (uint64_t)(estimate >> 64) + 1;
+    uint64_t r = low - q * divisor;
+    if (r > (uint64_t)estimate) {
+        q--;
+        r += divisor;
+    }
+    if (r >= divisor) {
+        q++;
+        r -= divisor;
+    }
+
+    quotient = q;
+    return r >> LimbShift;
+}
+
+// r[0 .. n) += a[0 .. n) · b en base LimbBase. Devuelve la palabra que sale
+template <size_t Base>
+uint64_t BigInt<Base>::mulAddLimbs(uint64_t* r, const uint64_t* a, size_t n, uint64_t b) {
+    uint64_t carry = 0;
+    for (size_t i = 0; i < n; i++) {
+        r[i] = splitLimb((unsigned __int128)a[i] * b + r[i] + carry, carry);
+    }
+    return carry;
+}
+
+template <size_t Base>
+Limbs BigInt<Base>::mulLimbs(const Limbs& num1, const Limbs& num2) {
+    Limbs result(num1.size() + num2.size(), 0);
+
+    for (size_t i = 0; i < num1.size(); i++) {
+        result[i + num2.size()] = mulAddLimbs(result.data() + i, num2.data(), num2.size(), num1[i]);
+    }
+
+    return result;
+}
+
+// Cuadrado en base LimbBase: los productos cruzados se calculan una vez y se
+// duplican, y después se suman los cuadrados de cada palabra
+template <size_t Base>
+Limbs BigInt<Base>::sqrLimbs(const Limbs& num) {
+    size_t n = num.size();
+    Limbs result(2 * n, 0);
+
+    for (size_t i = 0; i < n; i++) {
+        result[i + n] = mulAddLimbs(result.data() + 2 * i + 1, num.data() + i + 1, n - i - 1, num[i]);
+    }
+
+    uint64_t carry = 0;
+    for (size_t i = 0; i < 2 * n; i++) {
+        uint64_t value = 2 * result[i] + carry;
+        carry = value >= LimbBase;
+        result[i] = carry ? value - LimbBase : value;
+    }
+
+    carry = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t high;
+        result[2 * i] = splitLimb((unsigned __int128)num[i] * num[i] + result[2 * i] + carry, high);
+        uint64_t value = result[2 * i + 1] + high;
+        carry = value >= LimbBase;
+        result[2 * i + 1] = carry ? value - LimbBase : value;
+    }
+
+    return result;
+}
+
+// División larga de magnitudes (Knuth, algoritmo D) en base LimbBase
+template <size_t Base>
+void BigInt<Base>::divLimbs(const Limbs& dividend, const Limbs& divider,
+                            Limbs& quotient, Limbs& remainder) {
+
+    size_t n = divider.size();
+
+    if (dividend.size() < n) {
+        quotient.clear();
+        remainder = dividend;
+        return;
+    }
+
+    size_t m = dividend.size() - n;
+    quotient.assign(m + 1, 0);
+
+    // Divisor de una sola palabra
+    if (n == 1) {
+        unsigned __int128 rest = 0;
+        for (size_t i = dividend.size(); i-- > 0;) {
+            rest = rest * LimbBase + dividend[i];
+            quotient[i] = (uint64_t)(rest / divider[0]);
+            rest %= divider[0];
+        }
+        remainder.assign(1, (uint64_t)rest);
+        return;
+    }
+
+    // Normalizar para que la palabra alta del divisor sea al menos LimbBase / 2
+    uint64_t factor = LimbBase / (divider[n - 1] + 1);
+    std::vector<uint64_t> u(dividend.size() + 1, 0);
+    std::vector<uint64_t> v(n, 0);
+    uint64_t carry = 0;
+    for (size_t i = 0; i < dividend.size(); i++) {
+        u[i] = splitLimb((unsigned __int128)dividend[i] * factor + carry, carry);
+    }
+    u[dividend.size()] = carry;
+    carry = 0;
+    for (size_t i = 0; i < n; i++) {
+        v[i] = splitLimb((unsigned __int128)divider[i] * factor + carry, carry);
+    }
+
+    for (size_t j = m + 1; j-- > 0;) {
+        // Estimar la cifra del cociente con las dos palabras altas
+        unsigned __int128 top = (unsigned __int128)u[j + n] * LimbBase + u[j + n - 1];
+        unsigned __int128 qhat = top / v[n - 1];
+        unsigned __int128 rhat = top % v[n - 1];
+
+        while (qhat >= LimbBase || qhat * v[n - 2] > rhat * LimbBase + u[j + n - 2]) {
+            qhat--;
+            rhat += v[n - 1];
+            if (rhat >= LimbBase)
+                break;
+        }
+
+        // u[j .. j+n] -= qhat * v
+        int64_t borrow = 0;
+        uint64_t mulCarry = 0;
+        for (size_t i = 0; i < n; i++) {
+            uint64_t low = splitLimb(qhat * v[i] + mulCarry, mulCarry);
+            int64_t diff = (int64_t)u[i + j] - (int64_t)low - borrow;
+            borrow = diff < 0;
+            u[i + j] = borrow ? diff + LimbBase : diff;
+        }
+        int64_t diff = (int64_t)u[j + n] - (int64_t)mulCarry - borrow;
+
+        // Si el resultado es negativo qhat era una unidad mayor: se suma v de nuevo
+        if (diff < 0) {
+            u[j + n] = diff + LimbBase;
+            qhat--;
+            uint64_t addCarry = 0;
+            for (size_t i = 0; i < n; i++) {
+                uint64_t sum = u[i + j] + v[i] + addCarry;
+                addCarry = sum >= LimbBase;
+                u[i + j] = addCarry ? sum - LimbBase : sum;
+            }
+            u[j + n] = (u[j + n] + addCarry) % LimbBase;
+        } else {
+            u[j + n] = diff;
+        }
+
+        quotient[j] = (uint64_t)qhat;
+    }
+
+    // Deshacer la normalización del resto
+    remainder.assign(n, 0);
+    unsigned __int128 rest = 0;
+    for (size_t i = n; i-- > 0;) {
+        rest = rest * LimbBase + u[i];
+        remainder[i] = (uint64_t)(rest / factor);
+        rest %= factor;
+    }
+}
+
+// result = n1 + n2 (o n1 - n2 si subtract). result puede ser n1 o n2
+template <size_t Base>
+void BigInt<Base>::add(BigInt<Base>& result, const BigInt<Base>& n1, const BigInt<Base>& n2, bool subtract) {
+    int64_t a, b;
+    if (n1.toWord(a) && n2.toWord(b)) {
+        result.assignWord(subtract ? a - b : a + b);
+        return;
+    }
+
+    int sign1 = n1.sign_;
+    int sign2 = subtract ? -n2.sign_ : n2.sign_;
+
+    if (sign1 == sign2) {
+        addLimbs(result.limbs_, n1.limbs_, n2.limbs_);
+        result.sign_ = sign1;
+    } else if (compareLimbs(n1.limbs_, n2.limbs_) >= 0) {
+        subLimbs(result.limbs_, n1.limbs_, n2.limbs_);
+        result.sign_ = sign1;
+    } else {
+        subLimbs(result.limbs_, n2.limbs_, n1.limbs_);
+        result.sign_ = sign2;
+    }
+
+    result.normalize();
+}
+
+template <size_t Base>
+BigInt<Base> operator+(const BigInt<Base> &n1, const BigInt<Base> &n2) {
+    BigInt<Base> result;
+    BigInt<Base>::add(result, n1, n2, false);
+    return result;
+}
+
+template <size_t Base>
+BigInt<Base> BigInt<Base>::operator-(const BigInt<Base> &other) const {
+    BigInt<Base> result;
+    add(result, *this, other, true);
+    return result;
+}
+
+// La memoria crece con resize, que reserva de forma amortizada
+template <size_t Base>
+BigInt<Base>& BigInt<Base>::operator+=(const BigInt<Base> &other) {
+    add(*this, *this, other, false);
+    return *this;
+}
+
+template <size_t Base>
+BigInt<Base>& BigInt<Base>::operator-=(const BigInt<Base> &other) {
+    add(*this, *this, other, true);
+    return *this;
+}
+
+// Con un operando temporal el resultado se calcula en su memoria
+template <size_t Base>
+BigInt<Base> operator+(BigInt<Base> &&n1, const BigInt<Base> &n2) {
+    n1 += n2;
+    return std::move(n1);
+}
+
+template <size_t Base>
+BigInt<Base> operator+(const BigInt<Base> &n1, BigInt<Base> &&n2) {
+    n2 += n1;
+    return std::move(n2);
+}
+
+template <size_t Base>
+BigInt<Base> operator+(BigInt<Base> &&n1, BigInt<Base> &&n2) {
+    n1 += n2;
+    return std::move(n1);
+}
+
+template <size_t Base>
+BigInt<Base> operator-(BigInt<Base> &&n1, const BigInt<Base> &n2) {
+    n1 -= n2;
+    return std::move(n1);
+}
+
+template <size_t Base>
+BigInt<Base> operator-(const BigInt<Base> &n1, BigInt<Base> &&n2) {
+    BigInt<Base>::add(n2, n1, n2, true);
+    return std::move(n2);
+}
+
+template <size_t Base>
+BigInt<Base> operator-(BigInt<Base> &&n1, BigInt<Base> &&n2) {
+    n1 -= n2;
+    return std::move(n1);
+}
+
+template <size_t Base>
+BigInt<Base> operator-(BigInt<Base> &&n) {
+    if (!n.limbs_.empty())
+        n.sign_ = -n.sign_;
+    return std::move(n);
+}
+
+template <size_t Base>
+BigInt<Base> BigInt<Base>::operator-() const
+{
+  BigInt<Base> result(*this);
+  if (!result.limbs_.empty())
+    result.sign_ = -result.sign_;
+  return result;
+}
+
+
+template <size_t Base>
+BigInt<Base> BigInt<Base>::operator*(const BigInt<Base> &rhs) const
+{
+    BigInt<Base> result(*this);
+    result *= rhs;
+    return result;
+}
+
+// El producto necesita su propia memoria, que sustituye a la del número. Con
+// el mismo operando a los dos lados se eleva al cuadrado
+template <size_t Base>
+BigInt<Base>& BigInt<Base>::operator*=(const BigInt<Base> &rhs)
+{
+    int64_t a, b, c;
+    if (toWord(a) && rhs.toWord(b) && !__builtin_mul_overflow(a, b, &c)) {
+        assignWord(c);
+        return *this;
+    }
+
+    limbs_ = this == &rhs ? sqrLimbs(limbs_) : mulLimbs(limbs_, rhs.limbs_);
+    sign_ = sign_ * rhs.sign_;
+    normalize();
+    return *this;
+}
+
+// Cociente truncado hacia cero y resto con el signo del dividendo. Con
+// operandos grandes se divide en binario, donde está la división recursiva
+template <size_t Base>
+void BigInt<Base>::divide(const BigInt<Base>& dividend, const BigInt<Base>& divider, BigInt<Base>* quotient, BigInt<Base>* remainder) {
+
+    if (divider.limbs_.empty()) {
+        std::cout << "Division by zero" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    // Cociente y resto se calculan antes de escribir, por si son operandos
+    int64_t a, b;
+    if (dividend.toWord(a) && divider.toWord(b)) {
+        int64_t q = a / b;
+        int64_t r = a % b;
+        if (quotient != nullptr) {
+            quotient->assignWord(q);
+        }
+        if (remainder != nullptr) {
+            remainder->assignWord(r);
+        }
+        return;
+    }
+
+    size_t un = dividend.limbs_.size();
+    size_t vn = divider.limbs_.size();
+
+    if (vn >= BIGINT_BZ_THRESHOLD && un >= vn + BIGINT_BZ_THRESHOLD) {
+        BigInt<2> result, rest;
+        BigInt<2>::divide(BigInt<2>(dividend), BigInt<2>(divider),
+                          quotient != nullptr ? &result : nullptr,
+                          remainder != nullptr ? &rest : nullptr);
+        if (quotient != nullptr) {
+            *quotient = BigInt<Base>(result);
+        }
+        if (remainder != nullptr) {
+            *remainder = BigInt<Base>(rest);
+        }
+        return;
+    }
+
+    BigInt<Base> result;
+    BigInt<Base> rest;
+    divLimbs(dividend.limbs_, divider.limbs_, result.limbs_, rest.limbs_);
+
+    if (quotient != nullptr) {
+        result.sign_ = dividend.sign_ * divider.sign_;
+        result.normalize();
+        *quotient = std::move(result);
+    }
+
+    if (remainder != nullptr) {
+        rest.sign_ = dividend.sign_;
+        rest.normalize();
+        *remainder = std::move(rest);
+    }
+}
+
+template <size_t Base>
+BigInt<Base> operator/(const BigInt<Base> &dividend, const BigInt<Base> &divider) {
+    BigInt<Base> result;
+    BigInt<Base>::divide(dividend, divider, &result, nullptr);
+    return result;
+}
+
+template <size_t Base>
+BigInt<Base> BigInt<Base>::operator%(const BigInt<Base> &rhs) const
+{
+    BigInt<Base> result;
+    divide(*this, rhs, nullptr, &result);
+    return result;
+}
+
+// divide lee los operandos antes de escribir el resultado, así que este
+// puede ser el propio dividendo
+template <size_t Base>
+BigInt<Base>& BigInt<Base>::operator/=(const BigInt<Base> &rhs)
+{
+    divide(*this, rhs, this, nullptr);
+    return *this;
+}
+
+template <size_t Base>
+BigInt<Base>& BigInt<Base>::operator%=(const BigInt<Base> &rhs)
+{
+    divide(*this, rhs, nullptr, this);
+    return *this;
+}
+
+// Devuelve (dividend / divider, dividend % divider) con una sola división
+template <size_t Base>
+std::pair<BigInt<Base>, BigInt<Base>> divmod(const BigInt<Base> &dividend, const BigInt<Base> &divider) {
+    std::pair<BigInt<Base>, BigInt<Base>> result;
+    BigInt<Base>::divide(dividend, divider, &result.first, &result.second);
+    return result;
+}
+
+template <size_t Base>
+BigInt<Base> pow(const BigInt<Base> &a, const BigInt<Base> &b)
+{
+  if (b < BigInt<Base>(0L))
+  {
+    std::cerr << "Error: el exponente no puede ser negativo." << std::endl;
+    return BigInt<Base>();
+  }
+
+  // Exponenciación binaria de derecha a izquierda: el exponente se va
+  // dividiendo entre dos y la base se eleva al cuadrado en cada paso
+  BigInt<Base> res(1L);
+  BigInt<Base> power = a;
+  power.sign_ = 1;
+  Limbs exponent = b.limbs_;
+  bool odd = !exponent.empty() && exponent[0] % 2 == 1;
+
+  while (!exponent.empty())
+  {
+    // LimbBase es par, así que la paridad la decide la palabra baja
+    if (exponent[0] % 2 == 1)
+      res *= power;
+
+    uint64_t rest = 0;
+    for (size_t i = exponent.size(); i-- > 0;)
+    {
+      unsigned __int128 value = (unsigned __int128)rest * BigInt<Base>::LimbBase + exponent[i];
+      exponent[i] = (uint64_t)(value / 2);
+      rest = (uint64_t)(value % 2);
+    }
+    while (!exponent.empty() && exponent.back() == 0)
+      exponent.pop_back();
+
+    if (!exponent.empty())
+      power *= power;
+  }
+
+  res.sign_ = a.sign_ < 0 && odd ? -1 : 1;
+  res.normalize();
+  return res;
+}
@@ -22,24 +22,104 @@
 #include <sstream>
 #include <map>
 #include <fstream>
-#include <stack>
+#include <unordered_map>
+#include <queue>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 #include "../include/bigint.h"
 
+// Instrucciones de la máquina de pila que evalúa las líneas con ?
+enum OpCode {
+    OP_PUSH,        // apila el valor de la posición slot del tablero
+    OP_LAST,        // apila una copia del valor en la posición slot de la pila
+    OP_ADD, OP_SUB, OP_MUL, OP_DIV, OP_MOD, OP_DIVMOD, OP_POW,
+    OP_SHL, OP_SHR, OP_AND, OP_OR, OP_XOR, OP_NOT
+};
+
+struct Instruction {
+    OpCode op;
+    int slot;
+};
+
+// Línea compilada: los operandos ya resueltos a posiciones del tablero.
+// target es la posición donde se guarda el resultado (-1 si la línea no
+// tiene operadores) y resultDepth cuántos valores hay por encima de él en la
+// pila al terminar (1 si el último operador es /%, que deja el resto encima).
+// error tiene el mensaje si la línea no es válida
+struct Program {
+    std::vector<Instruction> code;
+    int target = -1;
+    int resultDepth = 0;
+    size_t maxDepth = 0;
+    std::string error;
+};
+
+// Tabla de símbolos: las entradas en orden de inserción (el orden en el que
+// se imprimen) y un índice hash de cada nombre a su posición. Las entradas no
+// se borran, así que la posición de un símbolo no cambia nunca y las líneas
+// compiladas se pueden guardar y volver a ejecutar
+struct Board {
+    std::vector<std::pair<std::string, BigInt<2>>> entries;
+    std::unordered_map<std::string, int> slots;
+    std::unordered_map<std::string, Program> programs;
+};
+
+// Grafo de dependencias entre líneas. Cada nodo es una asignación o una línea
+// con operadores y deja su valor en result, no en el tablero, de modo que una
+// posición reescrita por varias líneas tiene un valor por cada escritura y
+// solo importan las dependencias de lectura tras escritura
+struct Node {
+    const Program *program = nullptr;       // nullptr en las asignaciones
+    std::function<BigInt<2>()> load;        // conversión de una asignación
+    std::vector<int> sources;               // productor de cada OP_PUSH
+    std::vector<int> dependents;
+    int pending = 0;                        // dependencias sin terminar
+    int readers = 0;                        // dependientes sin terminar
+    bool final = false;                     // última escritura de su posición
+    BigInt<2> result;
+    std::string warnings;                   // avisos para std::cerr
+    std::string error;                      // error de ejecución, si lo hay
+    bool done = false;                      // ya evaluado
+};
+
+struct Graph {
+    std::vector<Node> nodes;
+    std::vector<int> writers;               // último nodo que escribe cada posición
+};
+
 std::vector<std::string> readData(std::string filename);
 int getBase(std::string line);
 
+// El tablero guarda los valores en binario para todas las bases: solo se
+// convierten desde la base de entrada al leer una asignación y hacia ella al
+// imprimir, no en cada operación. Cada línea se añade al grafo y se evalúa
+// después con runGraph
 template<size_t Base>
-void processData(std::vector<std::pair<std::string, BigInt<Base>>> &board, std::string data);
+void processData(Board &board, Graph &graph, std::string data);
 
-template<size_t Base>
-int getIndexOfKey(std::vector<std::pair<std::string, BigInt<Base>>> &board, std::string key);
+int addNode(Graph &graph, int slot, const std::vector<int> &sources);
 
-template<size_t Base>
-bool checkKey(std::vector<std::pair<std::string, BigInt<Base>>> &board, std::string key);
+void runGraph(Board &board, Graph &graph);
+
+void failLine(Board &board, Graph &graph, const std::string &message);
+
+int getIndexOfKey(Board &board, const std::string &key);
+
+bool checkKey(Board &board, const std::string &key);
+
+int addKey(Board &board, const std::string &key, const BigInt<2> &value);
+
+int internKey(Board &board, const std::string &key);
 
 template <size_t Base>
-void printBoard(std::vector<std::pair<std::string, BigInt<Base>>> &board, std::ofstream &fileout);
+void printBoard(Board &board, std::ofstream &fileout);
+
+Program compileLine(Board &board, const std::string &key, const std::string &expression);
+
+void runProgram(const Program &program, const std::vector<const BigInt<2>*> &operands, BigInt<2> &result, std::string &warnings, std::string &error);
 
 int main(int argc, char const *argv[]) {
     
@@ -55,10 +135,12 @@ int main(int argc, char const *argv[]) {
         
         case 2:
             {
-                std::vector<std::pair<std::string, BigInt<baseBinary>>> board;
-                for (int i = 1; i < data.size(); i++) {
-                    processData<baseBinary>(board, data[i]);
+                Board board;
+                Graph graph;
+                for (size_t i = 1; i < data.size(); i++) {
+                    processData<baseBinary>(board, graph, data[i]);
                 }
+                runGraph(board, graph);
                 std::ofstream fileout("output.txt");
                 printBoard<baseBinary>(board, fileout);
                 fileout.close();
@@ -66,10 +148,12 @@ int main(int argc, char const *argv[]) {
             }
         case 8:
             {
-                std::vector<std::pair<std::string, BigInt<baseOctal>>> board;
-                for (int i = 1; i < data.size(); i++) {
-                    processData<baseOctal>(board, data[i]);
+                Board board;
+                Graph graph;
+                for (size_t i = 1; i < data.size(); i++) {
+                    processData<baseOctal>(board, graph, data[i]);
                 }
+                runGraph(board, graph);
                 std::ofstream fileout("output.txt");
                 printBoard<baseOctal>(board, fileout);
                 fileout.close();
@@ -78,10 +162,12 @@ int main(int argc, char const *argv[]) {
         
         case 10:
             {
-                std::vector<std::pair<std::string, BigInt<baseDecimal>>> board;
-                for (int i = 1; i < data.size(); i++) {
-                    processData<baseDecimal>(board, data[i]);
+                Board board;
+                Graph graph;
+                for (size_t i = 1; i < data.size(); i++) {
+                    processData<baseDecimal>(board, graph, data[i]);
                 }
+                runGraph(board, graph);
                 std::ofstream fileout("output.txt");
                 printBoard<baseDecimal>(board, fileout);
                 fileout.close();
@@ -91,10 +177,12 @@ int main(int argc, char const *argv[]) {
 
         case 16:
             {
-                std::vector<std::pair<std::string, BigInt<baseHex>>> board;
-                for (int i = 1; i < data.size(); i++) {
-                    processData<baseHex>(board, data[i]);
+                Board board;
+                Graph graph;
+                for (size_t i = 1; i < data.size(); i++) {
+                    processData<baseHex>(board, graph, data[i]);
                 }
+                runGraph(board, graph);
                 std::ofstream fileout("output.txt");
                 printBoard<baseHex>(board, fileout);
                 fileout.close();
@@ -126,12 +214,11 @@ int getBase(std::string line) {
 }
 
 template<size_t Base>
-void processData(std::vector<std::pair<std::string, BigInt<Base>>> &board, std::string data) {
+void processData(Board &board, Graph &graph, std::string data) {
 
     std::string key;
     std::string value;
 
-    std::stack<std::string> stack;
 
     // Si la línea contiene un = es una asignación
     if(data.find("=") != std::string::npos) {
@@ -144,8 +231,16 @@ void processData(std::vector<std::pair<std::string, BigInt<Base>>> &board, std::
         // std::cout << "Key: " << key << std::endl;
         // std::cout << "Value: " << value << std::endl;
 
-        BigInt<Base> num(value);
-        board.push_back(std::make_pair(key, num));
+        // Las cifras se validan aquí, en orden, y el cambio a binario se hace
+        // en el grafo
+        const char* error = BigInt<Base>::check(value);
+        if (error != nullptr) {
+            failLine(board, graph, error);
+        }
+        BigInt<Base> literal(value);
+        int slot = addKey(board, key, BigInt<2>());
+        int node = addNode(graph, slot, std::vector<int>());
+        graph.nodes[node].load = [literal]() { return BigInt<2>(literal); };
 
     } else if(data.find("?") != std::string::npos) {
 
@@ -153,145 +248,414 @@ void processData(std::vector<std::pair<std::string, BigInt<Base>>> &board, std::
         // // // Imprimir valores
         // std::cout << "Key: " << key << std::endl;
 
-        std::vector<std::string> tokens;
-        std::istringstream iss(data.substr(data.find("?") + 1));
-        std::string token;
-        while (iss >> token) {
-            tokens.push_back(token);
+        // Cada línea distinta se compila una sola vez
+        std::unordered_map<std::string, Program>::iterator it = board.programs.find(data);
+        if (it == board.programs.end()) {
+            Program program = compileLine(board, key, data.substr(data.find("?") + 1));
+            if (!program.error.empty()) {
+                failLine(board, graph, program.error);
+            }
+            it = board.programs.insert(std::make_pair(data, program)).first;
         }
 
-        for (int i = 0; i < tokens.size(); ++i) {
-            if (tokens[i] == "+") {
-                BigInt<Base> value1 = board[getIndexOfKey(board, stack.top())].second;
-                BigInt<2> num1 = value1;
-                stack.pop();
+        // Una línea sin operadores no escribe nada
+        const Program &program = it->second;
+        if (program.target != -1) {
+            std::vector<int> sources;
+            for (size_t i = 0; i < program.code.size(); i++) {
+                if (program.code[i].op == OP_PUSH) {
+                    sources.push_back(graph.writers[program.code[i].slot]);
+                }
+            }
+            int node = addNode(graph, program.target, sources);
+            graph.nodes[node].program = &program;
+        }
+    } 
+}
 
-                BigInt<Base> value2 = board[getIndexOfKey(board, stack.top())].second;
-                BigInt<2> num2 = value2;
-                stack.pop();
+// Añade un nodo que lee los valores de sources y escribe en slot
+int addNode(Graph &graph, int slot, const std::vector<int> &sources) {
+
+    int index = (int)graph.nodes.size();
+    graph.nodes.push_back(Node());
+    Node &node = graph.nodes[index];
+    node.sources = sources;
+
+    // Una arista por cada productor distinto
+    std::vector<int> producers = sources;
+    std::sort(producers.begin(), producers.end());
+    producers.erase(std::unique(producers.begin(), producers.end()), producers.end());
+    for (size_t i = 0; i < producers.size(); i++) {
+        graph.nodes[producers[i]].dependents.push_back(index);
+        graph.nodes[producers[i]].readers++;
+    }
+    node.pending = (int)producers.size();
 
-                BigInt<2> result = num2 + num1;
+    if (graph.writers.size() <= (size_t)slot) {
+        graph.writers.resize(slot + 1, -1);
+    }
+    if (graph.writers[slot] != -1) {
+        graph.nodes[graph.writers[slot]].final = false;
+    }
+    graph.writers[slot] = index;
+    node.final = true;
 
+    return index;
+}
 
-                if (checkKey(board, key)) {
-                    board[getIndexOfKey(board, key)].second = result;
-                } else {
-                    board.push_back(std::make_pair(key, result));
-                }
+// Evalúa el grafo con TaskPool::size() hilos mientras el principal espera.
+// Un nodo pasa a la cola cuando han terminado todos sus productores, y de la
+// cola sale siempre el de la línea más baja. El valor de un productor se
+// libera en cuanto lo han leído todos sus dependientes, salvo que sea la
+// última escritura de su posición. Al final el tablero recibe el valor de la última
+// escritura de cada posición, como en la ejecución en orden.
+// Los hilos no salen del programa: un nodo que falla guarda su error y desde
+// entonces solo se evalúan los nodos anteriores a él. En cuanto han terminado
+// todos, el principal informa del error sin esperar a los nodos posteriores
+// que sigan en marcha, igual que la ejecución en orden, que no los empezaría
+void runGraph(Board &board, Graph &graph) {
+
+    std::vector<Node> &nodes = graph.nodes;
+    std::priority_queue<int, std::vector<int>, std::greater<int>> ready;
+    size_t running = 0;
+    size_t next = 0;                        // primer nodo sin terminar
+    size_t failed = nodes.size();           // primer nodo con error
+    std::mutex mutex;
+    std::condition_variable condition;
+
+    for (size_t i = 0; i < nodes.size(); i++) {
+        if (nodes[i].pending == 0) {
+            ready.push((int)i);
+        }
+    }
 
-                stack.push(board[getIndexOfKey(board, key)].first);
+    // Sin nodos en la cola ni en ejecución no puede quedar ninguno por evaluar
+    auto worker = [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            condition.wait(lock, [&]() { return !ready.empty() || running == 0; });
+            if (ready.empty()) {
+                return;
+            }
+            size_t index = ready.top();
+            ready.pop();
+            if (index > failed) {
+                continue;
+            }
+            running++;
+            lock.unlock();
 
-            } else if (tokens[i] == "-") {
+            Node &node = nodes[index];
+            if (node.program == nullptr) {
+                node.result = node.load();
+            } else {
+                std::vector<const BigInt<2>*> operands(node.sources.size());
+                for (size_t i = 0; i < node.sources.size(); i++) {
+                    operands[i] = &nodes[node.sources[i]].result;
+                }
+                runProgram(*node.program, operands, node.result, node.warnings, node.error);
+            }
 
-                BigInt<Base> value1 = board[getIndexOfKey(board, stack.top())].second;
-                BigInt<2> num1 = value1;
-                stack.pop();
+            lock.lock();
+            running--;
+            node.done = true;
+            while (next < nodes.size() && nodes[next].done) {
+                next++;
+            }
+            if (!node.error.empty()) {
+                failed = std::min(failed, index);
+                condition.notify_all();
+                continue;
+            }
+            for (size_t i = 0; i < node.dependents.size(); i++) {
+                if (--nodes[node.dependents[i]].pending == 0) {
+                    ready.push(node.dependents[i]);
+                }
+            }
+            std::vector<int> producers = node.sources;
+            std::sort(producers.begin(), producers.end());
+            producers.erase(std::unique(producers.begin(), producers.end()), producers.end());
+            for (size_t i = 0; i < producers.size(); i++) {
+                Node &producer = nodes[producers[i]];
+                if (--producer.readers == 0 && !producer.final) {
+                    producer.result = BigInt<2>();
+                }
+            }
+            condition.notify_all();
+        }
+    };
 
-                BigInt<Base> value2 = board[getIndexOfKey(board, stack.top())].second;
-                BigInt<2> num2 = value2;
-                stack.pop();
+    // Tantos hilos como el repartidor de las multiplicaciones, de modo que
+    // BIGINT_THREADS limita los dos. Un hilo que espera a sus productos
+    // parciales ejecuta tareas del repartidor mientras tanto
+    size_t count = std::min(TaskPool::size(), nodes.size());
 
-                BigInt<2> result = num2 - num1;
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < count; i++) {
+        threads.push_back(std::thread(worker));
+    }
 
-                if (checkKey(board, key)) {
-                    board[getIndexOfKey(board, key)].second = result;
-                } else {
-                    board.push_back(std::make_pair(key, result));
-                }
+    // Los avisos y el error se imprimen en el orden de las líneas. quick_exit
+    // no destruye los objetos estáticos que aún usan los nodos en marcha
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [&]() { return next == nodes.size() || next > failed; });
+        if (failed < nodes.size()) {
+            for (size_t i = 0; i <= failed; i++) {
+                std::cerr << nodes[i].warnings;
+            }
+            std::cout << nodes[failed].error << std::endl;
+            std::quick_exit(EXIT_FAILURE);
+        }
+        for (size_t i = 0; i < nodes.size(); i++) {
+            std::cerr << nodes[i].warnings;
+        }
+    }
+    for (size_t i = 0; i < threads.size(); i++) {
+        threads[i].join();
+    }
 
-                stack.push(board[getIndexOfKey(board, key)].first);
+    // Cada nodo escribe una sola posición, así que su valor se mueve al
+    // tablero, donde se guarda con la memoria justa
+    for (size_t slot = 0; slot < graph.writers.size(); slot++) {
+        if (graph.writers[slot] != -1) {
+            board.entries[slot].second = std::move(nodes[graph.writers[slot]].result);
+            board.entries[slot].second.shrink_to_fit();
+        }
+    }
+}
 
-            } else if (tokens[i] == "*") {
+// Sale con el error de una línea que no se puede leer. Antes se evalúan las
+// anteriores, que en la ejecución en orden habrían informado de los suyos
+void failLine(Board &board, Graph &graph, const std::string &message) {
+    runGraph(board, graph);
+    std::cout << message << std::endl;
+    exit(EXIT_FAILURE);
+}
 
-                BigInt<Base> value1 = board[getIndexOfKey(board, stack.top())].second;
-                BigInt<2> num1 = value1;
-                stack.pop();
+// Traduce la expresión en notación polaca inversa a instrucciones,
+// comprobando que cada operador tenga suficientes operandos en la pila. Tras
+// el primer operador, key ya contiene el resultado del último (el cociente
+// con /%), así que se lee de la pila y no del tablero
+Program compileLine(Board &board, const std::string &key, const std::string &expression) {
+
+    Program program;
+    size_t depth = 0;
+    int last = -1;          // posición en la pila del resultado del último operador
+
+    std::istringstream iss(expression);
+    std::string token;
+    while (iss >> token) {
+
+        Instruction instruction;
+        instruction.slot = 0;
+        size_t arity = 2;
+
+        if (token == "+") {
+            instruction.op = OP_ADD;
+        } else if (token == "-") {
+            instruction.op = OP_SUB;
+        } else if (token == "*") {
+            instruction.op = OP_MUL;
+        } else if (token == "/") {
+            instruction.op = OP_DIV;
+        } else if (token == "%") {
+            instruction.op = OP_MOD;
+        } else if (token == "/%") {
+            // Apila el cociente y encima el resto, con una sola división
+            instruction.op = OP_DIVMOD;
+        } else if (token == "^") {
+            instruction.op = OP_POW;
+        } else if (token == "<<") {
+            instruction.op = OP_SHL;
+        } else if (token == ">>") {
+            instruction.op = OP_SHR;
+        } else if (token == "&") {
+            instruction.op = OP_AND;
+        } else if (token == "|") {
+            instruction.op = OP_OR;
+        } else if (token == "xor") {
+            // ^ es la potencia, así que el o exclusivo se escribe xor
+            instruction.op = OP_XOR;
+        } else if (token == "~") {
+            instruction.op = OP_NOT;
+            arity = 1;
+        } else if (token == key && last != -1) {
+            instruction.op = OP_LAST;
+            instruction.slot = last;
+            arity = 0;
+        } else {
+            instruction.op = OP_PUSH;
+            instruction.slot = getIndexOfKey(board, token);
+            arity = 0;
+            if (instruction.slot == -1) {
+                program.error = "Undefined variable " + token;
+                return program;
+            }
+        }
 
-                BigInt<Base> value2 = board[getIndexOfKey(board, stack.top())].second;
-                BigInt<2> num2 = value2;
-                stack.pop();
+        if (depth < arity) {
+            program.error = "Invalid expression";
+            return program;
+        }
 
-                BigInt<2> result = num2 * num1;
+        depth = depth - arity + (instruction.op == OP_DIVMOD ? 2 : 1);
+        program.maxDepth = std::max(program.maxDepth, depth);
+        if (instruction.op != OP_PUSH && instruction.op != OP_LAST) {
+            program.target = 0;
+            program.resultDepth = instruction.op == OP_DIVMOD ? 1 : 0;
+            last = (int)(depth - 1) - program.resultDepth;
+        }
 
-                if (checkKey(board, key)) {
-                    board[getIndexOfKey(board, key)].second = result;
-                } else {
-                    board.push_back(std::make_pair(key, result));
-                }
+        program.code.push_back(instruction);
+    }
 
-                stack.push(board[getIndexOfKey(board, key)].first);
+    // El resultado se guarda en key solo si la línea tiene algún operador
+    if (program.target != -1) {
+        program.target = internKey(board, key);
+    }
 
-            } else if (tokens[i] == "/") {
+    return program;
+}
 
-                BigInt<Base> value1 = board[getIndexOfKey(board, stack.top())].second;
-                BigInt<2> num1 = value1;
-                stack.pop();
+// Ejecuta una línea compilada sobre una pila de valores. operands tiene el
+// valor de cada OP_PUSH en orden y result recibe el del último operador. Los
+// casos en los que BigInt<2> avisaría o saldría se comprueban antes de operar:
+// los avisos se añaden a warnings y un error se deja en error y para la línea
+void runProgram(const Program &program, const std::vector<const BigInt<2>*> &operands, BigInt<2> &result, std::string &warnings, std::string &error) {
 
-                BigInt<Base> value2 = board[getIndexOfKey(board, stack.top())].second;
-                BigInt<2> num2 = value2;
-                stack.pop();
+    std::vector<BigInt<2>> stack;
+    stack.reserve(program.maxDepth);
+    size_t operand = 0;
 
-                BigInt<2> result = num2 / num1;
+    for (size_t i = 0; i < program.code.size(); i++) {
 
-                if (checkKey(board, key)) {
-                    board[getIndexOfKey(board, key)].second = result;
-                } else {
-                    board.push_back(std::make_pair(key, result));
-                }
+        const Instruction &instruction = program.code[i];
 
-                stack.push(board[getIndexOfKey(board, key)].first);
+        if (instruction.op == OP_PUSH) {
+            stack.push_back(*operands[operand++]);
+            continue;
+        }
 
-            } else if (tokens[i] == "%") {
-                    
-                    BigInt<Base> value1 = board[getIndexOfKey(board, stack.top())].second;
-                    BigInt<2> num1 = value1;
-                    stack.pop();
-    
-                    BigInt<Base> value2 = board[getIndexOfKey(board, stack.top())].second;
-                    BigInt<2> num2 = value2;
-                    stack.pop();
-    
-                    BigInt<2> result = num2 % num1;
-    
-                    if (checkKey(board, key)) {
-                        board[getIndexOfKey(board, key)].second = result;
-                    } else {
-                        board.push_back(std::make_pair(key, result));
-                    }
-    
-                    stack.push(board[getIndexOfKey(board, key)].first);
+        if (instruction.op == OP_LAST) {
+            stack.push_back(stack[instruction.slot]);
+            continue;
+        }
 
-            } else {
-                stack.push(tokens[i]);
-            }
+        if (instruction.op == OP_NOT) {
+            stack.back() = ~stack.back();
+            continue;
         }
-    } 
-}
 
-template<size_t Base>
-int getIndexOfKey(std::vector<std::pair<std::string, BigInt<Base>>> &board, std::string key) {
-    for (int i = 0; i < board.size(); i++) {
-        if (board[i].first == key) {
-            return i;
+        // Los valores de la pila son temporales: se opera sobre su memoria
+        BigInt<2> num1 = std::move(stack.back());
+        stack.pop_back();
+        BigInt<2> &num2 = stack.back();
+
+        switch (instruction.op) {
+            case OP_DIV:
+            case OP_MOD:
+            case OP_DIVMOD:
+                if (num1 == BigInt<2>()) {
+                    error = "Division by zero";
+                    return;
+                }
+                break;
+            case OP_POW:
+                if (num1 < BigInt<2>()) {
+                    warnings += "Error: el exponente no puede ser negativo.\n";
+                    num2 = BigInt<2>();
+                    continue;
+                }
+                break;
+            case OP_SHL:
+            case OP_SHR:
+                if (!num2.leftShiftFits(instruction.op == OP_SHL ? num1 : -num1)) {
+                    error = "Shift too large";
+                    return;
+                }
+                break;
+            default:
+                break;
         }
-    }
-    return -1;
-}
 
-template <size_t Base>
-bool checkKey(std::vector<std::pair<std::string, BigInt<Base>>> &board, std::string key) {
-    for (int i = 0; i < board.size(); i++) {
-        if (board[i].first == key) {
-            return true;
+        switch (instruction.op) {
+            case OP_ADD:
+                num2 += num1;
+                break;
+            case OP_SUB:
+                num2 -= num1;
+                break;
+            case OP_MUL:
+                num2 *= num1;
+                break;
+            case OP_DIV:
+                num2 /= num1;
+                break;
+            case OP_MOD:
+                num2 %= num1;
+                break;
+            case OP_DIVMOD:
+                {
+                    std::pair<BigInt<2>, BigInt<2>> result = divmod(num2, num1);
+                    num2 = std::move(result.first);
+                    stack.push_back(std::move(result.second));
+                    break;
+                }
+            case OP_POW:
+                num2 = pow(num2, num1);
+                break;
+            case OP_SHL:
+                num2 <<= num1;
+                break;
+            case OP_SHR:
+                num2 >>= num1;
+                break;
+            case OP_AND:
+                num2 = num2 & num1;
+                break;
+            case OP_OR:
+                num2 = num2 | num1;
+                break;
+            case OP_XOR:
+                num2 = num2 ^ num1;
+                break;
+            default:
+                break;
         }
     }
-    return false;
+
+    result = std::move(stack[stack.size() - 1 - program.resultDepth]);
+}
+
+int getIndexOfKey(Board &board, const std::string &key) {
+    std::unordered_map<std::string, int>::const_iterator it = board.slots.find(key);
+    return it != board.slots.end() ? it->second : -1;
+}
+
+bool checkKey(Board &board, const std::string &key) {
+    return board.slots.count(key) != 0;
+}
+
+// Añade una entrada al final. Si el nombre ya existía se imprime dos veces,
+// pero las búsquedas siguen encontrando la primera entrada
+int addKey(Board &board, const std::string &key, const BigInt<2> &value) {
+    int index = (int)board.entries.size();
+    board.entries.push_back(std::make_pair(key, value));
+    board.slots.emplace(key, index);
+    return index;
+}
+
+// Posición de key, añadiéndola al final si todavía no existe
+int internKey(Board &board, const std::string &key) {
+    int index = getIndexOfKey(board, key);
+    return index != -1 ? index : addKey(board, key, BigInt<2>());
 }
 
 template <size_t Base>
-void printBoard(std::vector<std::pair<std::string, BigInt<Base>>> &board, std::ofstream &fileout) {
-    for (int i = 0; i < board.size(); i++) {
-        fileout << board[i].first << " => " << board[i].second << std::endl;
+void printBoard(Board &board, std::ofstream &fileout) {
+    for (size_t i = 0; i < board.entries.size(); i++) {
+        fileout << board.entries[i].first << " => " << BigInt<Base>(board.entries[i].second) << std::endl;
     }
 }
 
@@ -0,0 +1,16 @@
+#!/bin/sh
+# Ejecuta ./p2 con cada tests/<nombre>.txt y compara lo que imprime y su
+# código de salida con tests/<nombre>.out. El límite de tiempo hace que un
+# bloqueo cuente como fallo
+status=0
+for input in tests/*.txt; do
+    expected="${input%.txt}.out"
+    actual=$(timeout 20 ./p2 "$input" 2>&1; echo "exit $?")
+    if [ "$actual" = "$(cat "$expected")" ]; then
+        echo "ok   $input"
+    else
+        echo "FAIL $input"
+        status=1
+    fi
+done
+exit $status